@@ -0,0 +1,87 @@
+#include <atomic>  // std::atomic
+#include <cstddef> // std::max_align_t, std::size_t
+#include <cstdint> // std::int64_t
+#include <cstdlib> // std::malloc, std::free
+#include <new>     // std::bad_alloc
+
+#include <benchmark/benchmark.h>
+
+#include "allocation_counting.h"
+
+namespace {
+
+std::atomic<std::int64_t> numOfAllocations{0};
+std::atomic<std::int64_t> numOfAllocatedBytes{0};
+
+// (size of each allocation is kept in front of it, so that deallocations can be subtracted from live bytes)
+std::atomic<std::int64_t> numOfLiveBytes{0};
+std::atomic<std::int64_t> numOfPeakLiveBytes{0};
+constexpr std::size_t SIZE_PREFIX = alignof(std::max_align_t);
+
+void* countedAllocation(const std::size_t size) {
+
+    void* ptr = std::malloc(SIZE_PREFIX + size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(ptr) = size;
+
+    const auto signedSize = static_cast<std::int64_t>(size);
+    numOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    numOfAllocatedBytes.fetch_add(signedSize, std::memory_order_relaxed);
+
+    const std::int64_t live = numOfLiveBytes.fetch_add(signedSize, std::memory_order_relaxed) + signedSize;
+    std::int64_t peak = numOfPeakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak && !numOfPeakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    return static_cast<char*>(ptr) + SIZE_PREFIX;
+}
+
+void countedDeallocation(void* ptr) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+
+    void* allocation = static_cast<char*>(ptr) - SIZE_PREFIX;
+    const std::size_t size = *static_cast<std::size_t*>(allocation);
+    numOfLiveBytes.fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    std::free(allocation);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAllocation(size); }
+void* operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void* ptr) noexcept { countedDeallocation(ptr); }
+void operator delete[](void* ptr) noexcept { countedDeallocation(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { countedDeallocation(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { countedDeallocation(ptr); }
+
+namespace allocation_counting {
+
+AllocationTotals allocationTotals() {
+    return AllocationTotals{numOfAllocations.load(std::memory_order_relaxed),
+                            numOfAllocatedBytes.load(std::memory_order_relaxed)};
+}
+
+std::int64_t liveBytes() { return numOfLiveBytes.load(std::memory_order_relaxed); }
+
+std::int64_t peakLiveBytes() { return numOfPeakLiveBytes.load(std::memory_order_relaxed); }
+
+void resetPeakLiveBytes() {
+    numOfPeakLiveBytes.store(numOfLiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void reportAllocationsPerIteration(benchmark::State& state, const AllocationTotals& before) {
+
+    const AllocationTotals after = allocationTotals();
+    state.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(after.numOfAllocations - before.numOfAllocations), benchmark::Counter::kAvgIterations);
+    state.counters["allocated_bytes"] =
+        benchmark::Counter(static_cast<double>(after.numOfAllocatedBytes - before.numOfAllocatedBytes),
+                           benchmark::Counter::kAvgIterations, benchmark::Counter::kIs1024);
+}
+
+} // namespace allocation_counting
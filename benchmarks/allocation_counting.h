@@ -0,0 +1,29 @@
+#ifndef MINESWEEPER_BENCHMARKS_ALLOCATION_COUNTING_H
+#define MINESWEEPER_BENCHMARKS_ALLOCATION_COUNTING_H
+
+#include <cstdint> // std::int64_t
+
+#include <benchmark/benchmark.h>
+
+// counting of heap allocations made through global 'operator new',
+// which 'allocation_counting.cpp' replaces for the whole benchmark executable
+namespace allocation_counting {
+
+// number of allocations and allocated bytes since the start of the executable
+struct AllocationTotals {
+    std::int64_t numOfAllocations;
+    std::int64_t numOfAllocatedBytes;
+};
+AllocationTotals allocationTotals();
+
+// bytes currently allocated, and the most of them allocated at once since 'resetPeakLiveBytes'
+std::int64_t liveBytes();
+std::int64_t peakLiveBytes();
+void resetPeakLiveBytes();
+
+// reports allocations and allocated bytes made since 'before', per iteration of 'state'
+void reportAllocationsPerIteration(benchmark::State& state, const AllocationTotals& before);
+
+} // namespace allocation_counting
+
+#endif // MINESWEEPER_BENCHMARKS_ALLOCATION_COUNTING_H
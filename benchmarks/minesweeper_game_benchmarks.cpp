@@ -0,0 +1,800 @@
+#include <algorithm> // std::max, std::min, std::shuffle
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int8_t, std::int64_t
+#include <random>    // std::mt19937
+#include <sstream>   // std::istringstream, std::ostringstream
+#include <string>    // std::string
+#include <utility>   // std::move, std::pair
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+#include <minesweeper/action_log.h>
+#include <minesweeper/game.h>
+#include <minesweeper/i_random.h>
+#include <minesweeper/latency_recorder.h>
+#include <minesweeper/random.h>
+#include <minesweeper/reveal_engine.h>
+#include <minesweeper/serialisation_format.h>
+#include <minesweeper/visual_minesweeper_cell.h>
+
+#include "allocation_counting.h"
+
+namespace {
+
+// deterministic random, so that every run benchmarks identical grids
+class SeededRandom : public minesweeper::IRandom {
+  public:
+    void shuffleVector(std::vector<int>& vec) override { std::shuffle(vec.begin(), vec.end(), this->_uRng); }
+
+  private:
+    std::mt19937 _uRng{2021};
+};
+
+// square grid sizes used by most benchmarks
+void gridSizeArguments(benchmark::internal::Benchmark* b) {
+    for (int gridSize : {9, 100, 1'000, 4'000}) {
+        b->Arg(gridSize);
+    }
+}
+
+// square grid sizes and densities of mines (in percent) used by benchmarks which depend on the density
+// (100 stands for the highest density the grid size allows, see 'proportionOfMines')
+void gridSizeAndDensityArguments(benchmark::internal::Benchmark* b) {
+    for (int gridSize : {9, 100, 1'000, 4'000}) {
+        for (int density : {1, 10, 20, 100}) {
+            b->Args({gridSize, density});
+        }
+    }
+}
+
+double proportionOfMines(const int gridSize, const int density) {
+    return std::min(density / 100.0, minesweeper::Game::maxProportionOfMines(gridSize, gridSize));
+}
+
+// first cell of the grid that is not visible
+std::pair<int, int> hiddenCell(const minesweeper::Game& game) {
+    for (int y = 0; y < game.getGridHeight(); ++y) {
+        for (int x = 0; x < game.getGridWidth(); ++x) {
+            if (!game.isCellVisible(x, y)) {
+                return {x, y};
+            }
+        }
+    }
+    return {-1, -1};
+}
+
+std::int64_t hiddenCells(const minesweeper::Game& game) {
+    std::int64_t output = 0;
+    for (int y = 0; y < game.getGridHeight(); ++y) {
+        for (int x = 0; x < game.getGridWidth(); ++x) {
+            output += game.isCellVisible(x, y) ? 0 : 1;
+        }
+    }
+    return output;
+}
+
+// first visible cell of the grid which has mines around it, and hidden cells without mines around it
+std::pair<int, int> completableCell(const minesweeper::Game& game) {
+
+    const auto hasHiddenNeighbourWithoutMine = [&game](const int x, const int y) {
+        for (int neighbourY = std::max(y - 1, 0); neighbourY <= std::min(y + 1, game.getGridHeight() - 1);
+             ++neighbourY) {
+            for (int neighbourX = std::max(x - 1, 0); neighbourX <= std::min(x + 1, game.getGridWidth() - 1);
+                 ++neighbourX) {
+                if (!game.isCellVisible(neighbourX, neighbourY) && !game.doesCellHaveMine(neighbourX, neighbourY)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    for (int y = 0; y < game.getGridHeight(); ++y) {
+        for (int x = 0; x < game.getGridWidth(); ++x) {
+            if (game.isCellVisible(x, y) && game.numOfMinesAroundCell(x, y) != 0 &&
+                hasHiddenNeighbourWithoutMine(x, y)) {
+                return {x, y};
+            }
+        }
+    }
+    return {-1, -1};
+}
+
+// +-----------------------+
+// | construction of Game: |
+// +-----------------------+
+
+void BM_GameConstruction(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    for (auto _ : state) {
+        minesweeper::Game game(gridSize, 0.1, &random);
+        benchmark::DoNotOptimize(game);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameConstruction)->Apply(gridSizeArguments);
+
+// heap memory held by a started game, and the most of it held at once while the game was created and started
+void BM_GameFootprint(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    std::int64_t numOfBytes = 0;
+    std::int64_t numOfPeakBytes = 0;
+    for (auto _ : state) {
+        const std::int64_t liveBytesBefore = allocation_counting::liveBytes();
+        allocation_counting::resetPeakLiveBytes();
+
+        minesweeper::Game game(gridSize, 0.1, &random);
+        game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+        benchmark::DoNotOptimize(game);
+
+        numOfBytes = allocation_counting::liveBytes() - liveBytesBefore;
+        numOfPeakBytes = allocation_counting::peakLiveBytes() - liveBytesBefore;
+    }
+
+    const double numOfCells = static_cast<double>(gridSize) * gridSize;
+    state.counters["bytes"] =
+        benchmark::Counter(static_cast<double>(numOfBytes), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["peak_bytes"] = benchmark::Counter(static_cast<double>(numOfPeakBytes),
+                                                      benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["bytes_per_cell"] = static_cast<double>(numOfBytes) / numOfCells;
+    state.counters["peak_bytes_per_cell"] = static_cast<double>(numOfPeakBytes) / numOfCells;
+}
+BENCHMARK(BM_GameFootprint)->Apply(gridSizeArguments);
+
+// new game in an existing game (reusing its storage)
+void BM_GameNewGame(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        game.newGame(gridSize, 0.1);
+        benchmark::DoNotOptimize(game);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameNewGame)->Apply(gridSizeArguments);
+
+// moving a started game
+void BM_GameMove(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        minesweeper::Game moved(std::move(game));
+        benchmark::DoNotOptimize(moved);
+        game = std::move(moved);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_GameMove)->Apply(gridSizeArguments);
+
+// +-------------------------------------------+
+// | first check (mine and number generation): |
+// +-------------------------------------------+
+
+void BM_GameFirstCheck(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    minesweeper::Random random;
+
+    minesweeper::Game game(gridSize, proportionOfMines(gridSize, static_cast<int>(state.range(1))), &random);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        game.reset();
+        state.ResumeTiming();
+
+        game.createMinesAndNums(gridSize / 2, gridSize / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations() * game.getNumOfMines());
+}
+// (at low densities, mine generation should not depend on grid size)
+BENCHMARK(BM_GameFirstCheck)->Apply(gridSizeAndDensityArguments);
+
+// +------------------------------------+
+// | revealing an opening (flood fill): |
+// +------------------------------------+
+
+void BM_GameRevealOpening(benchmark::State& state, const minesweeper::RevealEngine revealEngine) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    // very low density, so that the first check reveals most of the grid
+    minesweeper::Game game(gridSize, 0.01, &random, revealEngine);
+    game.createMinesAndNums(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        game.reset(true);
+        state.ResumeTiming();
+
+        game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK_CAPTURE(BM_GameRevealOpening, scanline, minesweeper::RevealEngine::SCANLINE)->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameRevealOpening, bitboard, minesweeper::RevealEngine::BITBOARD)->Apply(gridSizeArguments);
+
+// revealing a small opening on a dense grid (its cost should depend on the size of the opening, not of the grid)
+void BM_GameRevealSmallOpening(benchmark::State& state, const minesweeper::RevealEngine revealEngine) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    // (the first checked cell has no mines around it, hence it always opens)
+    minesweeper::Game game(gridSize, 0.2, &random, revealEngine);
+    game.createMinesAndNums(gridSize / 2, gridSize / 2);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    const auto openingSize = static_cast<std::int64_t>(gridSize) * gridSize - hiddenCells(game);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        game.reset(true);
+        state.ResumeTiming();
+
+        game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations() * openingSize);
+    state.counters["opening_size"] = static_cast<double>(openingSize);
+}
+BENCHMARK_CAPTURE(BM_GameRevealSmallOpening, scanline, minesweeper::RevealEngine::SCANLINE)->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameRevealSmallOpening, bitboard, minesweeper::RevealEngine::BITBOARD)->Apply(gridSizeArguments);
+
+// +------------------------------------------+
+// | moves (check, mark and complete around): |
+// +------------------------------------------+
+
+// checking a cell of a game whose mines have been created, at densities which leave openings of varying sizes
+// (move is undone between checks, which leaves mines in place)
+void BM_GameCheck(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, proportionOfMines(gridSize, static_cast<int>(state.range(1))), &random);
+    game.enableMoveJournal();
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    const auto openingSize = static_cast<std::int64_t>(gridSize) * gridSize - hiddenCells(game);
+    game.undoMove();
+
+    const allocation_counting::AllocationTotals allocationsBefore = allocation_counting::allocationTotals();
+    for (auto _ : state) {
+        game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+        state.PauseTiming();
+        game.undoMove();
+        state.ResumeTiming();
+    }
+
+    allocation_counting::reportAllocationsPerIteration(state, allocationsBefore);
+
+    state.SetItemsProcessed(state.iterations() * openingSize);
+    state.counters["opening_size"] = static_cast<double>(openingSize);
+}
+BENCHMARK(BM_GameCheck)->Apply(gridSizeAndDensityArguments);
+
+// marking and unmarking a cell (cost should not depend on the grid size)
+void BM_GameMark(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    const std::pair<int, int> cell = hiddenCell(game);
+
+    const allocation_counting::AllocationTotals allocationsBefore = allocation_counting::allocationTotals();
+    for (auto _ : state) {
+        game.markInputCoordinates(cell.first, cell.second);
+        game.markInputCoordinates(cell.first, cell.second);
+    }
+
+    allocation_counting::reportAllocationsPerIteration(state, allocationsBefore);
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_GameMark)->Apply(gridSizeArguments);
+
+// completing around a numbered cell whose mines are marked
+// (move is undone between completions)
+void BM_GameCompleteAround(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    // numbered cell at the edge of the opening, with some hidden cells without mines around it
+    const std::pair<int, int> cell = completableCell(game);
+    if (cell.first == -1) {
+        state.SkipWithError("no cell to complete around");
+        return;
+    }
+    for (int y = cell.second - 1; y <= cell.second + 1; ++y) {
+        for (int x = cell.first - 1; x <= cell.first + 1; ++x) {
+            if (x >= 0 && y >= 0 && x < gridSize && y < gridSize && game.doesCellHaveMine(x, y)) {
+                game.markInputCoordinates(x, y);
+            }
+        }
+    }
+    game.enableMoveJournal();
+
+    const allocation_counting::AllocationTotals allocationsBefore = allocation_counting::allocationTotals();
+    for (auto _ : state) {
+        game.completeAroundInputCoordinates(cell.first, cell.second);
+
+        state.PauseTiming();
+        game.undoMove();
+        state.ResumeTiming();
+    }
+
+    allocation_counting::reportAllocationsPerIteration(state, allocationsBefore);
+}
+BENCHMARK(BM_GameCompleteAround)->Apply(gridSizeArguments);
+
+// +------------------------+
+// | visualisation of Game: |
+// +------------------------+
+
+void BM_GameVisualise1d(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        auto visualisation = game.visualise<std::vector<minesweeper::VisualMinesweeperCell>>();
+        benchmark::DoNotOptimize(visualisation.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameVisualise1d)->Apply(gridSizeArguments);
+
+void BM_GameVisualise2d(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        auto visualisation = game.visualise<std::vector<std::vector<minesweeper::VisualMinesweeperCell>>>();
+        benchmark::DoNotOptimize(visualisation.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameVisualise2d)->Apply(gridSizeArguments);
+
+void BM_GameVisualiseSolution(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        auto visualisation = game.visualiseSolution<std::vector<minesweeper::VisualMinesweeperCell>>();
+        benchmark::DoNotOptimize(visualisation.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameVisualiseSolution)->Apply(gridSizeArguments);
+
+void BM_GameVisualiseSolutionData(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        auto visualisation = game.visualiseSolutionData<std::vector<minesweeper::VisualMinesweeperCell>>();
+        benchmark::DoNotOptimize(visualisation.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameVisualiseSolutionData)->Apply(gridSizeArguments);
+
+// visualising cell by cell
+void BM_GameVisualiseCell(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        for (int y = 0; y < gridSize; ++y) {
+            for (int x = 0; x < gridSize; ++x) {
+                benchmark::DoNotOptimize(game.visualiseCell(x, y));
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+}
+BENCHMARK(BM_GameVisualiseCell)->Apply(gridSizeArguments);
+
+// visualising every frame into a reused buffer
+// (64x64 grid has 4K cells and 1000x1000 grid has 1M cells)
+template <class T>
+void BM_GameVisualiseFrame(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    std::vector<T> frame(static_cast<std::size_t>(gridSize) * gridSize);
+    const allocation_counting::AllocationTotals allocationsBefore = allocation_counting::allocationTotals();
+    for (auto _ : state) {
+        game.visualise(frame.data(), frame.size());
+        benchmark::DoNotOptimize(frame.data());
+        benchmark::ClobberMemory();
+    }
+
+    allocation_counting::reportAllocationsPerIteration(state, allocationsBefore);
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+    state.counters["frames_per_second"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                             benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_GameVisualiseFrame, minesweeper::VisualMinesweeperCell)->Arg(64)->Arg(1'000);
+BENCHMARK_TEMPLATE(BM_GameVisualiseFrame, std::int8_t)->Arg(64)->Arg(1'000);
+BENCHMARK_TEMPLATE(BM_GameVisualiseFrame, int)->Arg(64)->Arg(1'000);
+
+// visualising an 80x40 viewport (cost should not depend on the grid size)
+void BM_GameVisualiseViewport(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        auto viewport = game.visualise<std::vector<std::vector<minesweeper::VisualMinesweeperCell>>>(
+            (gridSize - 80) / 2, (gridSize - 40) / 2, 80, 40);
+        benchmark::DoNotOptimize(viewport.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 80 * 40);
+}
+BENCHMARK(BM_GameVisualiseViewport)->Arg(100)->Arg(1'000)->Arg(3'000);
+
+// +-----------------------------+
+// | undoing and redoing a move: |
+// +-----------------------------+
+
+// undoing and redoing a single mark (cost should not depend on the grid size)
+void BM_GameUndoRedoMark(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.enableMoveJournal();
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    game.markInputCoordinates(0, 0);
+
+    const allocation_counting::AllocationTotals allocationsBefore = allocation_counting::allocationTotals();
+    for (auto _ : state) {
+        game.undoMove();
+        game.redoMove();
+    }
+
+    allocation_counting::reportAllocationsPerIteration(state, allocationsBefore);
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_GameUndoRedoMark)->Apply(gridSizeArguments);
+
+// undoing and redoing the first check, which reveals an opening
+void BM_GameUndoRedoOpening(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.01, &random);
+    game.enableMoveJournal();
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        game.undoMove();
+        game.redoMove();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_GameUndoRedoOpening)->Apply(gridSizeArguments);
+
+// copying a started game (cells are shared with the original, until either of them changes them)
+void BM_GameCopy(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        minesweeper::Game fork(game);
+        benchmark::DoNotOptimize(fork);
+    }
+}
+BENCHMARK(BM_GameCopy)->Apply(gridSizeArguments);
+
+// copying a started game and marking a single cell of the copy (only the changed tile of cells is copied)
+void BM_GameForkAndMark(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    for (auto _ : state) {
+        minesweeper::Game fork(game);
+        fork.markInputCoordinates(0, 0);
+        benchmark::DoNotOptimize(fork);
+    }
+}
+BENCHMARK(BM_GameForkAndMark)->Apply(gridSizeArguments);
+
+// +------------------------+
+// | serialisation of Game: |
+// +------------------------+
+
+// (JSON formats are not benchmarked with the largest grid size, whose JSON takes gigabytes)
+void BM_GameSerialise(benchmark::State& state, const minesweeper::SerialisationFormat format) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    // (seeded, so that the same game can be serialised in every format)
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.setGenerationSeed(2021);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    std::size_t numOfBytes = 0;
+    for (auto _ : state) {
+        std::ostringstream oss;
+        game.serialise(oss, format);
+        numOfBytes = oss.str().size();
+        benchmark::DoNotOptimize(numOfBytes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * numOfBytes));
+}
+BENCHMARK_CAPTURE(BM_GameSerialise, json, minesweeper::SerialisationFormat::JSON)->Arg(100)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_GameSerialise, compact_json, minesweeper::SerialisationFormat::COMPACT_JSON)
+    ->Arg(100)
+    ->Arg(1'000);
+BENCHMARK_CAPTURE(BM_GameSerialise, binary, minesweeper::SerialisationFormat::BINARY)->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameSerialise, seed_based, minesweeper::SerialisationFormat::SEED_BASED)->Apply(gridSizeArguments);
+
+// serialising into reused memory (without streams)
+void BM_GameSerialiseIntoMemory(benchmark::State& state, const minesweeper::SerialisationFormat format) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.setGenerationSeed(2021);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    std::vector<char> memory(game.serialisationSize(format));
+    for (auto _ : state) {
+        game.serialise(memory.data(), memory.size(), format);
+        benchmark::DoNotOptimize(memory.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * memory.size()));
+}
+BENCHMARK_CAPTURE(BM_GameSerialiseIntoMemory, compact_json, minesweeper::SerialisationFormat::COMPACT_JSON)
+    ->Arg(100)
+    ->Arg(1'000);
+BENCHMARK_CAPTURE(BM_GameSerialiseIntoMemory, binary, minesweeper::SerialisationFormat::BINARY)
+    ->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameSerialiseIntoMemory, seed_based, minesweeper::SerialisationFormat::SEED_BASED)
+    ->Apply(gridSizeArguments);
+
+// delta of a checkpointed game after a single move (cost should depend on the grid width only)
+void BM_GameSerialiseDelta(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    game.checkpoint();
+    game.markInputCoordinates(0, 0);
+
+    std::size_t numOfBytes = 0;
+    for (auto _ : state) {
+        std::ostringstream oss;
+        game.serialiseDelta(oss);
+        numOfBytes = oss.str().size();
+        benchmark::DoNotOptimize(numOfBytes);
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * numOfBytes));
+}
+BENCHMARK(BM_GameSerialiseDelta)->Apply(gridSizeArguments);
+
+void BM_GameDeserialise(benchmark::State& state, const minesweeper::SerialisationFormat format) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.setGenerationSeed(2021);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    std::ostringstream oss;
+    game.serialise(oss, format);
+    const std::string serialisation = oss.str();
+
+    for (auto _ : state) {
+        std::istringstream iss(serialisation);
+        minesweeper::Game loadedGame;
+        loadedGame.deserialise(iss);
+        benchmark::DoNotOptimize(loadedGame);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * serialisation.size()));
+}
+BENCHMARK_CAPTURE(BM_GameDeserialise, json, minesweeper::SerialisationFormat::JSON)->Arg(100)->Arg(1'000);
+BENCHMARK_CAPTURE(BM_GameDeserialise, compact_json, minesweeper::SerialisationFormat::COMPACT_JSON)
+    ->Arg(100)
+    ->Arg(1'000);
+BENCHMARK_CAPTURE(BM_GameDeserialise, binary, minesweeper::SerialisationFormat::BINARY)->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameDeserialise, seed_based, minesweeper::SerialisationFormat::SEED_BASED)
+    ->Apply(gridSizeArguments);
+
+// deserialising from memory (without streams)
+void BM_GameDeserialiseFromMemory(benchmark::State& state, const minesweeper::SerialisationFormat format) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+
+    minesweeper::Game game(gridSize, 0.1, &random);
+    game.setGenerationSeed(2021);
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+    std::vector<char> memory(game.serialisationSize(format));
+    game.serialise(memory.data(), memory.size(), format);
+
+    minesweeper::Game loadedGame;
+    for (auto _ : state) {
+        loadedGame.deserialise(memory.data(), memory.size());
+        benchmark::DoNotOptimize(loadedGame);
+    }
+
+    state.SetItemsProcessed(state.iterations() * gridSize * gridSize);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * memory.size()));
+}
+BENCHMARK_CAPTURE(BM_GameDeserialiseFromMemory, binary, minesweeper::SerialisationFormat::BINARY)
+    ->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_GameDeserialiseFromMemory, seed_based, minesweeper::SerialisationFormat::SEED_BASED)
+    ->Apply(gridSizeArguments);
+
+// replaying logs of many recorded games, on one thread and on all hardware threads
+void BM_ActionLogReplay(benchmark::State& state) {
+
+    const auto numOfThreads = static_cast<unsigned>(state.range(0));
+    const std::size_t numOfLogs = 1'000;
+    std::mt19937 moveRng(2021);
+
+    std::vector<minesweeper::ActionLog> logs(numOfLogs);
+    for (std::size_t i = 0; i < numOfLogs; ++i) {
+        minesweeper::Game game(16, 30, 99);
+        game.setGenerationSeed(i);
+        game.recordActions(&logs[i]);
+        for (int move = 0; move < 50 && !game.playerHasWon() && !game.playerHasLost(); ++move) {
+            const int x = static_cast<int>(moveRng() % 30);
+            const int y = static_cast<int>(moveRng() % 16);
+            if (move % 5 == 4) {
+                game.markInputCoordinates(x, y);
+            } else {
+                game.checkInputCoordinates(x, y);
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        minesweeper::ActionLog::replay(
+            logs, [](std::size_t, const minesweeper::Game& game) { benchmark::DoNotOptimize(&game); }, numOfThreads);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numOfLogs));
+}
+BENCHMARK(BM_ActionLogReplay)->Arg(1)->Arg(0)->UseRealTime();
+
+// +----------------------+
+// | recording latencies: |
+// +----------------------+
+
+// recording a latency into a recorder shared by all benchmark threads (each of which records into its own histograms)
+void BM_LatencyRecorderRecord(benchmark::State& state) {
+
+    static minesweeper::LatencyRecorder recorder;
+    std::uint64_t latency = 0;
+
+    for (auto _ : state) {
+        recorder.record(minesweeper::LatencyOperation::CHECK, minesweeper::BoardSizeClass::CLASSIC, latency);
+        latency = (latency + 997) % 1'000'000;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LatencyRecorderRecord)->Threads(1)->Threads(4);
+
+// checking a cell of a game, which records its latencies (compare with 'BM_GameCheck')
+void BM_GameCheckRecordingLatencies(benchmark::State& state) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    SeededRandom random;
+    minesweeper::LatencyRecorder recorder;
+
+    minesweeper::Game game(gridSize, proportionOfMines(gridSize, static_cast<int>(state.range(1))), &random);
+    game.recordLatencies(&recorder);
+    game.enableMoveJournal();
+    game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+    game.undoMove();
+
+    for (auto _ : state) {
+        game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+
+        state.PauseTiming();
+        game.undoMove();
+        state.ResumeTiming();
+    }
+
+    const minesweeper::LatencyHistogram histogram = recorder.histogram(
+        minesweeper::LatencyOperation::CHECK, minesweeper::LatencyRecorder::boardSizeClass(gridSize, gridSize));
+    state.counters["check_p50_ns"] = static_cast<double>(histogram.valueAtPercentile(50));
+    state.counters["check_p99_ns"] = static_cast<double>(histogram.valueAtPercentile(99));
+    state.counters["check_p999_ns"] = static_cast<double>(histogram.valueAtPercentile(99.9));
+}
+BENCHMARK(BM_GameCheckRecordingLatencies)->Args({9, 10})->Args({100, 10})->Args({1'000, 10});
+
+} // namespace
@@ -0,0 +1,124 @@
+#include <algorithm> // std::shuffle
+#include <cstdint>   // std::uint64_t
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+#include <minesweeper/fast_random.h>
+#include <minesweeper/game.h>
+#include <minesweeper/i_random.h>
+#include <minesweeper/random.h>
+
+namespace {
+
+// only overrides 'shuffleVector', so that default (shuffle based) 'chooseIndices' is used
+class ShuffleOnlyRandom : public minesweeper::IRandom {
+  public:
+    void shuffleVector(std::vector<int>& vec) override { std::shuffle(vec.begin(), vec.end(), this->_uRng); }
+
+  private:
+    std::mt19937 _uRng{2021};
+};
+
+// square grid sizes
+void gridSizeArguments(benchmark::internal::Benchmark* b) {
+    for (int gridSize : {9, 100, 1'000}) {
+        b->Arg(gridSize);
+    }
+}
+
+// +---------------------------+
+// | construction of a random: |
+// +---------------------------+
+
+void BM_RandomConstruction(benchmark::State& state) {
+
+    for (auto _ : state) {
+        minesweeper::Random random;
+        benchmark::DoNotOptimize(random);
+    }
+}
+BENCHMARK(BM_RandomConstruction);
+
+void BM_RandomSeededConstruction(benchmark::State& state) {
+
+    for (auto _ : state) {
+        minesweeper::Random random(2021);
+        benchmark::DoNotOptimize(random);
+    }
+}
+BENCHMARK(BM_RandomSeededConstruction);
+
+void BM_FastRandomSeededConstruction(benchmark::State& state) {
+
+    for (auto _ : state) {
+        minesweeper::FastRandom random(2021);
+        benchmark::DoNotOptimize(random);
+    }
+}
+BENCHMARK(BM_FastRandomSeededConstruction);
+
+// +---------------------------------------------------------+
+// | choosing mine indices (density 0.2, 3x3 area excluded): |
+// +---------------------------------------------------------+
+
+template <class RandomType>
+void BM_ChooseIndices(benchmark::State& state, RandomType random) {
+
+    const int gridSize = static_cast<int>(state.range(0));
+    const int numOfIndices = gridSize * gridSize;
+    const int numOfChosen = numOfIndices / 5;
+    const std::vector<int> excludedIndices{0, 1, 2, gridSize, gridSize + 1, gridSize + 2};
+
+    std::vector<int> chosenIndices;
+    for (auto _ : state) {
+        random.chooseIndices(chosenIndices, numOfChosen, numOfIndices, excludedIndices);
+        benchmark::DoNotOptimize(chosenIndices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numOfChosen);
+}
+BENCHMARK_CAPTURE(BM_ChooseIndices, shuffle, ShuffleOnlyRandom())->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_ChooseIndices, random, minesweeper::Random(2021))->Apply(gridSizeArguments);
+BENCHMARK_CAPTURE(BM_ChooseIndices, fast_random, minesweeper::FastRandom(2021))->Apply(gridSizeArguments);
+
+// +--------------------------------------------------------------+
+// | many small games (each with a new random and a first check): |
+// +--------------------------------------------------------------+
+
+void BM_NewGamesShuffle(benchmark::State& state) {
+
+    for (auto _ : state) {
+        ShuffleOnlyRandom random;
+        minesweeper::Game game(16, 30, 0.2, &random);
+        game.checkInputCoordinates(8, 15);
+        benchmark::DoNotOptimize(game);
+    }
+}
+BENCHMARK(BM_NewGamesShuffle);
+
+void BM_NewGamesRandom(benchmark::State& state) {
+
+    for (auto _ : state) {
+        minesweeper::Random random;
+        minesweeper::Game game(16, 30, 0.2, &random);
+        game.checkInputCoordinates(8, 15);
+        benchmark::DoNotOptimize(game);
+    }
+}
+BENCHMARK(BM_NewGamesRandom);
+
+void BM_NewGamesFastRandom(benchmark::State& state) {
+
+    std::uint64_t seed = 0;
+    for (auto _ : state) {
+        minesweeper::FastRandom random(++seed);
+        minesweeper::Game game(16, 30, 0.2, &random);
+        game.checkInputCoordinates(8, 15);
+        benchmark::DoNotOptimize(game);
+    }
+}
+BENCHMARK(BM_NewGamesFastRandom);
+
+} // namespace
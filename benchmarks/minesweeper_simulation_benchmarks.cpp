@@ -0,0 +1,223 @@
+#include <algorithm> // std::fill, std::max, std::max_element, std::min, std::nth_element
+#include <chrono>    // std::chrono
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int64_t
+#include <numeric>   // std::iota
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+#include <minesweeper/cell_change.h>
+#include <minesweeper/fast_random.h>
+#include <minesweeper/game.h>
+#include <minesweeper/i_random.h>
+
+#include "allocation_counting.h"
+
+namespace {
+
+// scripted player, which plays complete games through the public interface of 'Game', as a user interface would:
+// (chords around numbers whose mines are marked, marks cells which have to be mines,
+// and otherwise checks the next hidden cell in a seeded random order)
+class ScriptedPlayer {
+
+  public:
+    ScriptedPlayer(const int gridHeight, const int gridWidth, minesweeper::IRandom& random)
+        : _gridHeight{gridHeight}, _gridWidth{gridWidth},
+          _isQueued(static_cast<std::size_t>(gridHeight) * gridWidth, false),
+          _guessOrder(static_cast<std::size_t>(gridHeight) * gridWidth) {
+
+        std::iota(this->_guessOrder.begin(), this->_guessOrder.end(), 0);
+        random.shuffleVector(this->_guessOrder);
+    }
+
+    // plays a new game until it is won or lost, and appends latency of each move (in nanoseconds) to 'moveLatencies'
+    // (returns true, if the game was won)
+    bool play(minesweeper::Game& game, std::vector<std::int64_t>& moveLatencies) {
+
+        std::fill(this->_isQueued.begin(), this->_isQueued.end(), false);
+        this->_cellsToExamine.clear();
+        std::size_t nextGuess = 0;
+
+        while (!game.playerHasWon() && !game.playerHasLost()) {
+            if (!this->_cellsToExamine.empty()) {
+                const int cell = this->_cellsToExamine.back();
+                this->_cellsToExamine.pop_back();
+                this->_isQueued[cell] = false;
+                this->examine_(game, cell % this->_gridWidth, cell / this->_gridWidth, moveLatencies);
+                continue;
+            }
+
+            // nothing to deduce, hence guess
+            while (nextGuess < this->_guessOrder.size() &&
+                   (game.isCellVisible(this->_guessOrder[nextGuess] % this->_gridWidth,
+                                       this->_guessOrder[nextGuess] / this->_gridWidth) ||
+                    game.isCellMarked(this->_guessOrder[nextGuess] % this->_gridWidth,
+                                      this->_guessOrder[nextGuess] / this->_gridWidth))) {
+                ++nextGuess;
+            }
+            if (nextGuess == this->_guessOrder.size()) {
+                break;
+            }
+            const int x = this->_guessOrder[nextGuess] % this->_gridWidth;
+            const int y = this->_guessOrder[nextGuess] / this->_gridWidth;
+            this->move_(
+                [&game, x, y](std::vector<minesweeper::CellChange>& changes) {
+                    game.checkInputCoordinates(x, y, changes);
+                },
+                moveLatencies);
+        }
+
+        return game.playerHasWon();
+    }
+
+    // heap allocations made by moves of every game played so far
+    std::int64_t numOfAllocations() const { return this->_numOfAllocations; }
+
+  private:
+    int _gridHeight;
+    int _gridWidth;
+
+    // visible cells whose numbers might tell something new (queued again when cells around them change)
+    std::vector<int> _cellsToExamine;
+    std::vector<bool> _isQueued;
+
+    std::vector<int> _guessOrder;
+    std::vector<minesweeper::CellChange> _changes;
+
+    std::int64_t _numOfAllocations = 0;
+
+    void examine_(minesweeper::Game& game, const int x, const int y, std::vector<std::int64_t>& moveLatencies) {
+
+        if (!game.isCellVisible(x, y) || game.numOfMinesAroundCell(x, y) == 0) {
+            return;
+        }
+
+        int numOfMarked = 0;
+        int numOfHidden = 0;
+        this->forEachNeighbour_(x, y, [&game, &numOfMarked, &numOfHidden](const int neighbourX, const int neighbourY) {
+            if (game.isCellMarked(neighbourX, neighbourY)) {
+                ++numOfMarked;
+            } else if (!game.isCellVisible(neighbourX, neighbourY)) {
+                ++numOfHidden;
+            }
+        });
+
+        if (numOfHidden == 0) {
+            return;
+        }
+
+        if (numOfMarked == game.numOfMinesAroundCell(x, y)) {
+            this->move_(
+                [&game, x, y](std::vector<minesweeper::CellChange>& changes) {
+                    game.completeAroundInputCoordinates(x, y, changes);
+                },
+                moveLatencies);
+        } else if (numOfMarked + numOfHidden == game.numOfMinesAroundCell(x, y)) {
+            this->forEachNeighbour_(x, y, [this, &game, &moveLatencies](const int neighbourX, const int neighbourY) {
+                if (!game.isCellMarked(neighbourX, neighbourY) && !game.isCellVisible(neighbourX, neighbourY) &&
+                    !game.playerHasWon()) {
+                    this->move_(
+                        [&game, neighbourX, neighbourY](std::vector<minesweeper::CellChange>& changes) {
+                            game.markInputCoordinates(neighbourX, neighbourY, changes);
+                        },
+                        moveLatencies);
+                }
+            });
+        }
+    }
+
+    // makes a timed move (counting allocations it makes) and queues cells around its changes
+    template <class Move>
+    void move_(Move move, std::vector<std::int64_t>& moveLatencies) {
+
+        const std::int64_t numOfAllocationsBefore = allocation_counting::allocationTotals().numOfAllocations;
+        const auto start = std::chrono::steady_clock::now();
+        move(this->_changes);
+        const auto end = std::chrono::steady_clock::now();
+        this->_numOfAllocations += allocation_counting::allocationTotals().numOfAllocations - numOfAllocationsBefore;
+
+        moveLatencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        for (const minesweeper::CellChange& change : this->_changes) {
+            this->forEachNeighbour_(change.x, change.y, [this](const int neighbourX, const int neighbourY) {
+                const int cell = neighbourY * this->_gridWidth + neighbourX;
+                if (!this->_isQueued[cell]) {
+                    this->_isQueued[cell] = true;
+                    this->_cellsToExamine.push_back(cell);
+                }
+            });
+        }
+    }
+
+    // (including the cell itself)
+    template <class Function>
+    void forEachNeighbour_(const int x, const int y, Function function) const {
+        for (int neighbourY = std::max(y - 1, 0); neighbourY <= std::min(y + 1, this->_gridHeight - 1); ++neighbourY) {
+            for (int neighbourX = std::max(x - 1, 0); neighbourX <= std::min(x + 1, this->_gridWidth - 1);
+                 ++neighbourX) {
+                function(neighbourX, neighbourY);
+            }
+        }
+    }
+};
+
+// value at 'percentile' (from 0 to 1) of 'values' (which are reordered)
+double percentileOf(std::vector<std::int64_t>& values, const double percentile) {
+
+    if (values.empty()) {
+        return 0;
+    }
+
+    const auto nth = values.begin() + static_cast<std::ptrdiff_t>(percentile * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), nth, values.end());
+    return static_cast<double>(*nth);
+}
+
+// +--------------------------------------+
+// | complete games with scripted player: |
+// +--------------------------------------+
+
+// plays complete games one after another in the same 'Game' (mine layouts and guesses are seeded)
+// (games per second include the time taken by the scripted player, and move latencies and allocations do not)
+void BM_GameSimulation(benchmark::State& state, const int gridHeight, const int gridWidth, const int numOfMines) {
+
+    minesweeper::FastRandom gameRandom(2021);
+    minesweeper::FastRandom playerRandom(1337);
+
+    minesweeper::Game game(gridHeight, gridWidth, numOfMines, &gameRandom);
+    ScriptedPlayer player(gridHeight, gridWidth, playerRandom);
+
+    std::vector<std::int64_t> moveLatencies;
+    std::int64_t numOfGamesWon = 0;
+    std::int64_t numOfNewGameAllocations = 0;
+
+    for (auto _ : state) {
+        const std::int64_t numOfAllocationsBefore = allocation_counting::allocationTotals().numOfAllocations;
+        game.newGame(gridHeight, gridWidth, numOfMines);
+        numOfNewGameAllocations += allocation_counting::allocationTotals().numOfAllocations - numOfAllocationsBefore;
+
+        numOfGamesWon += player.play(game, moveLatencies) ? 1 : 0;
+    }
+
+    const auto numOfGames = static_cast<double>(state.iterations());
+    state.counters["games_per_second"] = benchmark::Counter(numOfGames, benchmark::Counter::kIsRate);
+    state.counters["win_rate"] = static_cast<double>(numOfGamesWon) / numOfGames;
+    state.counters["moves_per_game"] = static_cast<double>(moveLatencies.size()) / numOfGames;
+    state.counters["allocations_per_game"] =
+        static_cast<double>(numOfNewGameAllocations + player.numOfAllocations()) / numOfGames;
+
+    // latencies of moves (in nanoseconds)
+    state.counters["move_p50_ns"] = percentileOf(moveLatencies, 0.5);
+    state.counters["move_p90_ns"] = percentileOf(moveLatencies, 0.9);
+    state.counters["move_p99_ns"] = percentileOf(moveLatencies, 0.99);
+    state.counters["move_max_ns"] =
+        moveLatencies.empty() ? 0 : static_cast<double>(*std::max_element(moveLatencies.begin(), moveLatencies.end()));
+}
+BENCHMARK_CAPTURE(BM_GameSimulation, beginner, 9, 9, 10)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_GameSimulation, intermediate, 16, 16, 40)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_GameSimulation, expert, 16, 30, 99)->Unit(benchmark::kMicrosecond);
+// custom board, whose openings and mine generation dominate
+BENCHMARK_CAPTURE(BM_GameSimulation, huge, 1'000, 1'000, 100'000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
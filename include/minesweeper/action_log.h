@@ -0,0 +1,106 @@
+#ifndef MINESWEEPER_ACTION_LOG_H
+#define MINESWEEPER_ACTION_LOG_H
+
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint8_t, std::uint64_t
+#include <functional> // std::function
+#include <iostream>   // std::istream, std::ostream
+#include <vector>     // std::vector
+
+namespace minesweeper {
+
+class Game;
+
+// actions of 'Game', which are recorded into 'ActionLog':
+enum class ActionType : std::uint8_t {
+    CHECK,           // checkInputCoordinates(x, y)
+    MARK,            // markInputCoordinates(x, y)
+    COMPLETE_AROUND, // completeAroundInputCoordinates(x, y)
+    CREATE_MINES,    // createMinesAndNums(x, y)
+    UNDO,            // undoMove()
+    REDO,            // redoMove()
+    RESET,           // reset(keepCreatedMines)
+    NEW_GAME         // newGame(gridHeight, gridWidth, numOfMines)
+};
+
+// recorded action, and the arguments its type uses:
+struct Action {
+    ActionType type;
+    int x;
+    int y;
+    bool keepCreatedMines;
+    int gridHeight;
+    int gridWidth;
+    int numOfMines;
+};
+
+// log of actions of a game, which starts from a new game described by the header of the log:
+// (saved as a fixed-size header followed by a fixed-width record of each action)
+class ActionLog {
+
+  private:
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    // header:
+    int _gridHeight = 0;
+    int _gridWidth = 0;
+    int _numOfMines = 0;
+    bool _hasGenerationSeed = false;
+    std::uint64_t _generationSeed = 0;
+
+    std::vector<Action> _actions;
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // constructors:
+    ActionLog() = default;
+    ActionLog(int gridHeight, int gridWidth, int numOfMines);
+
+    // starts a new log of a new game (generation seed is cleared, but capacity for actions is kept):
+    void start(int gridHeight, int gridWidth, int numOfMines);
+
+    // header getters:
+    int getGridHeight() const;
+    int getGridWidth() const;
+    int getNumOfMines() const;
+
+    // generation seed of the game (replays of logs with a seed do not depend on 'IRandom'):
+    void setGenerationSeed(std::uint64_t seed);
+    void clearGenerationSeed();
+    bool hasGenerationSeed() const;
+    std::uint64_t getGenerationSeed() const;
+
+    // actions:
+    void append(const Action& action);
+    const std::vector<Action>& getActions() const;
+    std::size_t numOfActions() const;
+
+    // save and load log:
+    // (load throws 'std::invalid_argument', and leaves the log unchanged, if the saved log is invalid)
+    std::ostream& serialise(std::ostream& outStream) const;
+    std::istream& deserialise(std::istream& inStream);
+    std::size_t serialisationSize() const;
+
+    // replays the log: starts a new game described by the header in 'game' and executes the actions on it
+    // (logs without a generation seed choose mines with 'IRandom' of 'game', which has to be in the same state,
+    // as the one of the recorded game was, for the replay to be identical,
+    // and move journal of 'game' is enabled, if the log has undone or redone moves)
+    void replay(Game& game) const;
+
+    // replays logs on 'numOfThreads' threads (or one per hardware thread, if 0),
+    // and calls 'onReplayed' with the index of each log and its replayed game
+    // ('onReplayed' is called concurrently from the replaying threads, and throws 'std::invalid_argument'
+    // without replaying anything, if any of the logs has no generation seed, since those depend on 'IRandom')
+    static void replay(const std::vector<ActionLog>& logs,
+                       const std::function<void(std::size_t logIndex, const Game& game)>& onReplayed,
+                       unsigned numOfThreads = 0);
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_ACTION_LOG_H
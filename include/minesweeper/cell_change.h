@@ -0,0 +1,23 @@
+#ifndef MINESWEEPER_CELL_CHANGE_H
+#define MINESWEEPER_CELL_CHANGE_H
+
+#include <minesweeper/visual_minesweeper_cell.h>
+
+namespace minesweeper {
+
+// cell (x, y), whose visualisation changed during a move, and its new visualisation:
+struct CellChange {
+    int x;
+    int y;
+    VisualMinesweeperCell visualisation;
+};
+
+inline bool operator==(const CellChange& first, const CellChange& second) {
+    return first.x == second.x && first.y == second.y && first.visualisation == second.visualisation;
+}
+
+inline bool operator!=(const CellChange& first, const CellChange& second) { return !(first == second); }
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_CELL_CHANGE_H
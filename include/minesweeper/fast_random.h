@@ -0,0 +1,49 @@
+#ifndef MINESWEEPER_FAST_RANDOM_H
+#define MINESWEEPER_FAST_RANDOM_H
+
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+#include <minesweeper/i_random.h>
+
+namespace minesweeper {
+
+// small and fast alternative to 'Random' using xoshiro256** generator
+// (given the same seed, produces identical results on every platform,
+//  since it does not rely on standard library distributions or shuffles)
+class FastRandom : public IRandom {
+
+  private:
+    std::uint64_t _state[4] = {};
+
+  public:
+    // seeded by 'std::random_device'
+    FastRandom();
+
+    // explicitly seeded
+    explicit FastRandom(std::uint64_t seed);
+
+    // reseeds the generator
+    void seed(std::uint64_t seed);
+
+    // uniform random bit generator requirements (to allow usage with standard library):
+    using result_type = std::uint64_t;
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()();
+
+    // uniformly random integer from [0, upperBound]
+    std::uint32_t uniformInt(std::uint32_t upperBound);
+
+    void shuffleVector(std::vector<int>& vec) override;
+
+    // time taken depends only on 'numOfChosen' (and size of 'excludedIndices'),
+    // unless more than half of the non-excluded indices are chosen
+    // (chosen indices are not in random order)
+    void chooseIndices(std::vector<int>& chosenIndices, int numOfChosen, int numOfIndices,
+                       const std::vector<int>& excludedIndices) override;
+};
+} // namespace minesweeper
+
+#endif // MINESWEEPER_FAST_RANDOM_H
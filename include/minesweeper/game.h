@@ -1,14 +1,20 @@
 #ifndef MINESWEEPER_GAME_H
 #define MINESWEEPER_GAME_H
 
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int8_t, std::uint64_t
 #include <iostream>    // std::istream, std::ostream
-#include <memory>      // std::unique_ptr
-#include <queue>       // std::queue
-#include <type_traits> // std::enable_if
+#include <memory>      // std::shared_ptr, std::unique_ptr
+#include <type_traits> // std::enable_if, std::false_type, std::true_type
 #include <utility>     // std::pair
 #include <vector>      // std::vector
 
+#include <minesweeper/cell_change.h>
+#include <minesweeper/game_stats.h>
 #include <minesweeper/i_random.h>
+#include <minesweeper/reveal_engine.h>
+#include <minesweeper/serialisation_format.h>
 #include <minesweeper/type_traits.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
@@ -17,6 +23,16 @@ namespace minesweeper {
 // declaration of 'Cell' class, properly included in 'game.cpp' file
 class Cell;
 
+// declaration of 'MoveJournal' class, properly included in 'game.cpp' file
+class MoveJournal;
+
+// declarations of action log types, properly included in 'game.cpp' file
+class ActionLog;
+struct Action;
+
+// declaration of 'LatencyRecorder' class, properly included in 'game.cpp' file
+class LatencyRecorder;
+
 // this warning can be useful, but it does not support standard copy-swap idiom
 // (consider excluding this warning from the whole project)
 // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
@@ -35,18 +51,75 @@ class Game {
     bool _checkedMine = false;
     bool _minesHaveBeenSet = false;
 
-    std::vector<std::vector<std::unique_ptr<Cell>>> _cells;
+    // row-major cell storage surrounded by a ring of border (sentinel) cells,
+    // cell (x, y) is stored at index: (y + 1) * _stride + (x + 1) (row stride being '_gridWidth + 2')
+    int _stride = 2;
 
-    // field used to randomise vector of ints to choose locations of mines
+    // cells are split into tiles of '_tileSize' cells (whole rows, see 'MIN_CELL_TILE_SHIFT'),
+    // which copies of a game share until either of them changes a cell in the tile (copy-on-write)
+    int _tileSize = 1;
+    std::vector<std::shared_ptr<Cell>> _cellTiles;
+
+    // tile of cell index i is '(i * _tileReciprocal) >> _tileReciprocalShift'
+    // (exact for every non-negative int, and cheaper than dividing by '_tileSize')
+    std::uint64_t _tileReciprocal = 1;
+    int _tileReciprocalShift = 0;
+
+    // field used to choose locations of mines
     IRandom* _random = nullptr;
 
-    // static field used to randomise vector of ints to choose locations of mines
+    // static field used to choose locations of mines
     // only used if IRandom not specifically set for an instance
     // set with setDefaultRandom(IRandom* random)
     static IRandom* defaultRandom;
 
-    // queue of cell coordinates to be checked
-    std::queue<std::pair<const int, const int>> _cellCoordsToCheck;
+    // way of revealing openings
+    RevealEngine _revealEngine = RevealEngine::SCANLINE;
+
+    // seed of mine generation (when set, mines are chosen by 'FastRandom' seeded with it instead of 'IRandom',
+    // hence mine layout depends only on the seed, grid dimensions, number of mines and first checked cell)
+    bool _hasGenerationSeed = false;
+    std::uint64_t _generationSeed = 0;
+
+    // seed and cell, from which current mine layout was created
+    // (cell is -1, -1 unless mines have been created with a generation seed)
+    std::uint64_t _layoutSeed = 0;
+    int _firstCheckedX = -1;
+    int _firstCheckedY = -1;
+
+    // stack of cell indices from which spans of an opening are still to be revealed
+    // (kept between checks, so that its capacity is reused instead of reallocated)
+    std::vector<int> _openingSpanSeeds;
+
+    // bit planes used by 'RevealEngine::BITBOARD' (kept between checks like above)
+    std::vector<std::uint64_t> _openingBitPlanes;
+
+    // rows changed since the last checkpoint (bit y % 64 of word y / 64 for row y),
+    // which are not tracked while the whole grid has changed (new cells, mines, reset or undone reveal) since the
+    // checkpoint
+    std::vector<std::uint64_t> _changedRows;
+    bool _gridChanged = true;
+
+    // journal of moves, which can be undone and redone (null unless enabled)
+    std::unique_ptr<MoveJournal> _moveJournal;
+
+    // log, into which actions are recorded (null unless recording, and not copied with the game)
+    ActionLog* _actionLog = nullptr;
+
+    // recorder of latencies of operations (null unless recording, and not copied with the game)
+    LatencyRecorder* _latencyRecorder = nullptr;
+
+#ifdef MINESWEEPER_STATS
+    // statistics of hot paths (mutable, since they are also counted by const helpers of non-const methods)
+    mutable GameStats _stats;
+    // bytes serialised are counted apart, by const methods, which may run on the same game concurrently
+    // (relaxed atomic, hence counting them is no data race, unlike counting into '_stats')
+    mutable std::atomic<std::uint64_t> _numOfBytesSerialised{0};
+#endif
+
+    // changed cells of the current move are added here, when the caller asked for them
+    // (only set during a move, hence never copied)
+    std::vector<CellChange>* _cellChanges = nullptr;
 
   public:
     // +-----------------+
@@ -57,10 +130,14 @@ class Game {
     Game();
     Game(const Game& other);
     Game(Game&& other) noexcept;
-    Game(int gridSize, int numOfMines, IRandom* random = nullptr);
-    Game(int gridHeight, int gridWidth, int numOfMines, IRandom* random = nullptr);
-    Game(int gridSize, double proportionOfMines, IRandom* random = nullptr);
-    Game(int gridHeight, int gridWidth, double proportionOfMines, IRandom* random = nullptr);
+    Game(int gridSize, int numOfMines, IRandom* random = nullptr,
+         RevealEngine revealEngine = RevealEngine::SCANLINE);
+    Game(int gridHeight, int gridWidth, int numOfMines, IRandom* random = nullptr,
+         RevealEngine revealEngine = RevealEngine::SCANLINE);
+    Game(int gridSize, double proportionOfMines, IRandom* random = nullptr,
+         RevealEngine revealEngine = RevealEngine::SCANLINE);
+    Game(int gridHeight, int gridWidth, double proportionOfMines, IRandom* random = nullptr,
+         RevealEngine revealEngine = RevealEngine::SCANLINE);
 
     // default destructor:
     ~Game();
@@ -90,6 +167,12 @@ class Game {
     // checks trivial cells around already visible cell coordinates
     void completeAroundInputCoordinates(int x, int y);
 
+    // moves as above, which also replace contents of 'changes' with every cell whose visualisation changed
+    // (reusing its capacity, so that user interfaces can repaint only those cells)
+    void checkInputCoordinates(int x, int y, std::vector<CellChange>& changes);
+    void markInputCoordinates(int x, int y, std::vector<CellChange>& changes);
+    void completeAroundInputCoordinates(int x, int y, std::vector<CellChange>& changes);
+
     // game progress information:
     bool playerHasWon() const;
     bool playerHasLost() const;
@@ -104,13 +187,82 @@ class Game {
     int getGridHeight() const;
     int getGridWidth() const;
     int getNumOfMines() const;
+    RevealEngine getRevealEngine() const;
+
+    // seed-based mine generation methods:
+    // (seed is used for mine layouts created after setting it, and it is kept over resets and new games,
+    // while recording actions, the seed is also set in the log, and it can not be changed
+    // once the recorded actions have created mines, which throws 'std::invalid_argument')
+    void setGenerationSeed(std::uint64_t seed);
+    void clearGenerationSeed();
+    bool hasGenerationSeed() const;
+    std::uint64_t getGenerationSeed() const;
 
     // save game:
-    std::ostream& serialise(std::ostream& outStream) const;
+    // (JSON is written straight into the stream, without building the whole document in memory first)
+    std::ostream& serialise(std::ostream& outStream, SerialisationFormat format = SerialisationFormat::JSON) const;
 
-    // load game:
+    // save game into caller-provided memory (returns number of bytes written):
+    // (binary formats are written straight into the memory, without streams or intermediate buffers)
+    std::size_t serialise(char* output, std::size_t outputSize,
+                          SerialisationFormat format = SerialisationFormat::JSON) const;
+
+    // number of bytes 'serialise' writes:
+    // (JSON formats are counted by serialising them without storing the output)
+    std::size_t serialisationSize(SerialisationFormat format = SerialisationFormat::JSON) const;
+
+    // load game (any of the serialisation formats):
     std::istream& deserialise(std::istream& inStream);
 
+    // load game from caller-provided memory, such as a memory-mapped file (returns number of bytes read):
+    std::size_t deserialise(const char* input, std::size_t inputSize);
+
+    // move journal methods:
+    // (moves made while the journal is enabled can be undone and redone, until the game is reset or loaded,
+    // undoing the first check leaves its mines in place, and a new move drops moves which could have been redone)
+    void enableMoveJournal();
+    void disableMoveJournal();
+    bool isMoveJournalEnabled() const;
+    bool canUndoMove() const;
+    bool canRedoMove() const;
+    void undoMove();
+    void redoMove();
+    // (changed cells and their new visualisations are reported into 'changes')
+    void undoMove(std::vector<CellChange>& changes);
+    void redoMove(std::vector<CellChange>& changes);
+
+    // action recording methods:
+    // (recording starts from a game whose mines have not been created yet, and 'actionLog' is restarted
+    // with a header describing it, null 'actionLog' stops recording, and loading a game is not recorded)
+    void recordActions(ActionLog* actionLog);
+    bool isRecordingActions() const;
+
+    // latency recording methods:
+    // (latencies of checks, completions around cells and mine generation are recorded into 'latencyRecorder'
+    // by board size class, and null 'latencyRecorder' stops recording)
+    void recordLatencies(LatencyRecorder* latencyRecorder);
+    bool isRecordingLatencies() const;
+
+    // hot path statistics methods:
+    // (statistics are counted only if the library is built with 'MINESWEEPER_STATS' defined (by the CMake option
+    // of the same name), otherwise counting compiles away and 'stats' returns zeros,
+    // and const methods, such as 'serialise', stay safe to call concurrently on the same game either way)
+    GameStats stats() const;
+    void resetStats();
+    static bool statsAreEnabled();
+
+    // incremental save methods:
+    // (delta holds rows changed since the last checkpoint, and applies to a game saved at that checkpoint,
+    // or to the whole grid, if cells, mines or game have been created or reset, or a reveal has been undone
+    // since the checkpoint)
+    void checkpoint();
+    std::ostream& serialiseDelta(std::ostream& outStream) const;
+    std::istream& applyDelta(std::istream& inStream);
+    std::size_t applyDelta(const char* input, std::size_t inputSize);
+    // reads a serialisation followed by deltas (until the end of the stream) and saves them as one serialisation
+    static std::ostream& compactDeltas(std::istream& inStream, std::ostream& outStream,
+                                       SerialisationFormat format = SerialisationFormat::BINARY);
+
     // get visual information of a cell:
     template <class T = VisualMinesweeperCell>
     T visualiseCell(int x, int y) const;
@@ -123,6 +275,26 @@ class Game {
               typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
     Container visualise() const;
 
+    // get visual information of each cell in a rectangular area (viewport) of the grid:
+    // (area starts from (x, y) and is 'width' cells wide and 'height' cells high)
+    template <class Container,
+              typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type = 0>
+    Container visualise(int x, int y, int width, int height) const;
+    template <class Container,
+              typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
+    Container visualise(int x, int y, int width, int height) const;
+
+
+    // write visual information of each cell (row by row) into caller-provided storage:
+    // (buffers of 'VisualMinesweeperCell' and 'std::int8_t' (compact mode) are written without conversions,
+    // buffer version throws if 'bufferSize' is smaller than the number of cells,
+    // and iterator versions write values of type 'T', which defaults to the value type of the iterator
+    // (or of the container of an insert iterator), or to 'VisualMinesweeperCell', if it has none)
+    template <class T = void, class OutputIterator>
+    OutputIterator visualise(OutputIterator output) const;
+    template <class T>
+    void visualise(T* buffer, std::size_t bufferSize) const;
+
     // get visual solution information of a cell:
     // (every cell marked as: empty, number or marked)
     template <class T = VisualMinesweeperCell>
@@ -136,6 +308,16 @@ class Game {
     template <class Container,
               typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
     Container visualiseSolution() const;
+    template <class Container,
+              typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type = 0>
+    Container visualiseSolution(int x, int y, int width, int height) const;
+    template <class Container,
+              typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
+    Container visualiseSolution(int x, int y, int width, int height) const;
+    template <class T = void, class OutputIterator>
+    OutputIterator visualiseSolution(OutputIterator output) const;
+    template <class T>
+    void visualiseSolution(T* buffer, std::size_t bufferSize) const;
 
     // get visual solution data information of a cell:
     // (every cell marked as: empty, number or mine)
@@ -150,6 +332,16 @@ class Game {
     template <class Container,
               typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
     Container visualiseSolutionData() const;
+    template <class Container,
+              typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type = 0>
+    Container visualiseSolutionData(int x, int y, int width, int height) const;
+    template <class Container,
+              typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type = 0>
+    Container visualiseSolutionData(int x, int y, int width, int height) const;
+    template <class T = void, class OutputIterator>
+    OutputIterator visualiseSolutionData(OutputIterator output) const;
+    template <class T>
+    void visualiseSolutionData(T* buffer, std::size_t bufferSize) const;
 
     // +------------------------+
     // | public static methods: |
@@ -175,6 +367,16 @@ class Game {
 
     static const int MAX_NUMBER_OF_CELLS_AROUND_MINE;
 
+    // number of cells visualised at a time, when they are converted before output
+    static constexpr int VISUALISATION_CHUNK_SIZE = 256;
+
+    // at most this many cells per mine, numbers are counted for all cells at once instead of mine by mine
+    static const int NUM_OF_CELLS_PER_MINE_TO_COUNT_ALL_NUMS;
+
+    // tiles of cell storage hold at least '1 << MIN_CELL_TILE_SHIFT' cells
+    // (smaller tiles make copied games cheaper to change, larger ones make copying them cheaper)
+    static const int MIN_CELL_TILE_SHIFT;
+
     // serialisation magic/version keys:
     static const char* MAGIC_KEY;
     static const char* VERSION_KEY;
@@ -195,6 +397,13 @@ class Game {
     static const char* CHECKED_MINE_KEY;
     static const char* MINES_HAVE_BEEN_SET_KEY;
 
+    // +-----------------+
+    // | nested classes: |
+    // +-----------------+
+
+    // loader used by 'deserialise' (defined in 'game_json_loader.h')
+    class JsonLoader;
+
     // +------------------+
     // | private methods: |
     // +------------------+
@@ -204,24 +413,83 @@ class Game {
 
     // private mines creation methods:
     void createMinesAndNums_(int initChosenX, int initChosenY);
-    void chooseRandomMineCells_(std::vector<int>& mineSpots, int initChosenX, int initChosenY) const;
-    void randomizeMineVector_(std::vector<int>& mineSpots) const;
-    void createMine_(int x, int y);
-    void incrNumsAroundMine_(int x, int y);
+    void createMinesAndNums_(int initChosenX, int initChosenY, IRandom& random);
+    void chooseRandomMineCells_(IRandom& random, std::vector<int>& mineSpots, int initChosenX, int initChosenY) const;
+    IRandom& random_() const;
+    void createMine_(int cellIndex);
+    void incrNumsAroundMine_(int cellIndex);
+    void createNumsAroundMines_(const std::vector<int>& mineSpots);
+    // (from bit plane of mines, each row of the grid starting from a new 64-bit word)
+    void createNumsFromMineBits_(const std::vector<std::uint64_t>& mineBits);
+
+    // private JSON serialisation method (returns number of bytes written):
+    std::size_t serialiseJson_(std::ostream& outStream, bool prettyPrint) const;
+
+    // private binary serialisation methods (see format in 'game_binary_format.cpp'):
+    std::size_t binarySerialisationSize_(bool isSeedBased) const;
+    void serialiseBinaryHeader_(unsigned char* output, const unsigned char* magic, std::uint16_t formatFlags) const;
+    void serialiseBinary_(unsigned char* output) const;
+    std::ostream& serialiseBinary_(std::ostream& outStream) const;
+    std::size_t serialiseCellStateRuns_(unsigned char* output) const;
+    void serialiseSeedBased_(unsigned char* output, std::size_t outputSize) const;
+    std::ostream& serialiseSeedBased_(std::ostream& outStream) const;
+    static bool isBinarySerialisation_(std::istream& inStream);
+    static bool isBinarySerialisation_(const unsigned char* input, std::size_t inputSize);
+    std::istream& deserialiseBinary_(std::istream& inStream);
+    std::size_t deserialiseBinary_(const unsigned char* input, std::size_t inputSize);
+    std::size_t deserialiseSeedBased_(const unsigned char* input, std::size_t inputSize);
+    static void verifyBinaryHeader_(const unsigned char* header, const unsigned char* magic);
+    std::size_t applyDelta_(const unsigned char* input, std::size_t inputSize);
+
+    // private checkpoint method:
+    void markRowChanged_(int cellIndex);
+
+    // private move journal methods:
+    void beginMove_();
+    void endMove_();
+    void clearMoveJournal_();
+
+    // private action recording methods:
+    void recordAction_(const Action& action);
+    // (whether the recorded actions have created mines, which depend on the generation seed of the log)
+    bool recordedActionsHaveCreatedMines_() const;
+
+    // private statistics methods (do nothing, unless 'MINESWEEPER_STATS' is defined):
+    void countStat_(std::uint64_t GameStats::*stat, std::uint64_t amount = 1) const {
+#ifdef MINESWEEPER_STATS
+        this->_stats.*stat += amount;
+#else
+        static_cast<void>(stat);
+        static_cast<void>(amount);
+#endif
+    }
+    // (safe to call from const methods running concurrently)
+    void countBytesSerialised_(std::uint64_t numOfBytes) const {
+#ifdef MINESWEEPER_STATS
+        this->_numOfBytesSerialised.fetch_add(numOfBytes, std::memory_order_relaxed);
+#else
+        static_cast<void>(numOfBytes);
+#endif
+    }
 
     // private reset method:
     void reset_(bool keepCreatedMines = false);
 
     // private check cell methods:
-    void checkInputCoordinates_(int x, int y);
-    void checkAroundCoordinate_(int x, int y);
-    void makeCellVisible_(int x, int y);
-    void handleCellCoordsToCheckQueue_();
+    void checkCell_(int cellIndex);
+    void revealCell_(int cellIndex);
+    void revealCell_(Cell& cell, int cellIndex);
+    void revealOpening_(int cellIndex);
+    void revealOpeningSpan_(int seedIndex);
+    void revealOpeningBitboard_(int cellIndex);
 
     // private mark cell methods:
     void markCell_(int x, int y);
     void unmarkCell_(int x, int y);
 
+    // private move change-set method:
+    void addCellChange_(int cellIndex);
+
     // private win conditions:
     bool allNonMinesVisible_() const;
     bool allMinesMarked_() const;
@@ -232,13 +500,32 @@ class Game {
     // private loss conditions:
     bool checkedMine_() const;
 
+    // private cell access methods:
+    int cellIndex_(int x, int y) const;
+    int gridStride_() const;
+    int tileIndex_(int cellIndex) const;
+    const Cell& cell_(int cellIndex) const;
+    const Cell& cellAt_(int x, int y) const;
+    const Cell* cellRow_(int y) const;
+
+    // private cell modification methods:
+    // (tile of the cell, or row, is copied first, if it is shared with another game)
+    Cell& mutableCell_(int cellIndex);
+    Cell& mutableCellAt_(int x, int y);
+    Cell* mutableCellRow_(int y);
+    Cell* mutableTile_(int tileIndex);
+
+    // visits all 8 neighbour indices of a cell without any bounds checks or allocations
+    // (neighbours of cells on the edge of the grid include border cells)
+    template <class NeighbourFunction>
+    void forEachNeighbour_(int cellIndex, NeighbourFunction neighbourFunction) const;
+
     // private cell information methods:
     bool isCellVisible_(int x, int y) const;
     bool doesCellHaveMine_(int x, int y) const;
     bool isCellMarked_(int x, int y) const;
     int numOfMinesAroundCell_(int x, int y) const;
     int numOfMarkedCellsAroundCell_(int x, int y) const;
-    std::vector<std::pair<int, int>> neighbourCells_(int x, int y) const;
 
     // private visual cell information:
     VisualMinesweeperCell visualiseCell_(int x, int y) const;
@@ -250,18 +537,33 @@ class Game {
     VisualMinesweeperCell visualiseCellSolutionData_(int x, int y) const;
 
     // private visualisation details:
+    // (cells are numbered row by row without border cells)
+    enum class VisualisationType { CELL, CELL_SOLUTION, CELL_SOLUTION_DATA };
+    template <class T>
+    void visualiseCells_(VisualisationType visualisationType, int firstCell, int numOfCells, T* output) const;
+    // (void 'T' is deduced from 'OutputIterator')
+    template <class T, class OutputIterator>
+    OutputIterator visualisationDetailIn_(VisualisationType visualisationType, int firstCell, int numOfCells,
+                                          OutputIterator output) const;
+    template <class T, class OutputIterator>
+    OutputIterator visualisationDetailIn_(VisualisationType visualisationType, int firstCell, int numOfCells,
+                                          OutputIterator output, std::true_type writesStraightIntoOutput) const;
+    template <class T, class OutputIterator>
+    OutputIterator visualisationDetailIn_(VisualisationType visualisationType, int firstCell, int numOfCells,
+                                          OutputIterator output, std::false_type writesStraightIntoOutput) const;
+    template <class T>
+    void visualisationDetailInBuffer_(VisualisationType visualisationType, T* buffer, std::size_t bufferSize) const;
     template <class Container>
-    Container visualisationDetailIn1d_(VisualMinesweeperCell (Game::*cellVisualisationMethod)(int, int) const) const;
+    Container visualisationDetailIn1d_(VisualisationType visualisationType, int areaX, int areaY, int areaWidth,
+                                       int areaHeight) const;
     template <class Container>
-    Container visualisationDetailIn2d_(VisualMinesweeperCell (Game::*cellVisualisationMethod)(int, int) const) const;
+    Container visualisationDetailIn2d_(VisualisationType visualisationType, int areaX, int areaY, int areaWidth,
+                                       int areaHeight) const;
 
     // +-------------------------+
     // | private static methods: |
     // +-------------------------+
 
-    // private static cell initialisation methods:
-    static std::vector<std::vector<std::unique_ptr<Cell>>> initCells_(int gridHeight, int gridWidth);
-    static std::vector<std::vector<std::unique_ptr<Cell>>> initCells_(const Game& other);
 
     // private static verification methods:
     static int verifyGridDimension_(int gridDimension);
@@ -271,6 +573,8 @@ class Game {
     static int verifyNumOfMarkedMines_(int numOfMarkedMines, int numOfMines);
     static int verifyNumOfWronglyMarkedCells_(int numOfWronglyMarkedCells, int gridHeight, int gridWidth,
                                               int numOfMines);
+    static void verifyVisualisationArea_(int areaX, int areaY, int areaWidth, int areaHeight, int gridHeight,
+                                         int gridWidth);
 };
 
 } // namespace minesweeper
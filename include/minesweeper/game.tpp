@@ -2,14 +2,38 @@
 #error __FILE__ should only be included from game.h
 #endif
 
-#include <stdexcept>   // std::out_of_range
-#include <type_traits> // std::enable_if
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int8_t
+#include <iterator>    // std::back_inserter
+#include <stdexcept>   // std::out_of_range, std::invalid_argument
+#include <string>      // std::to_string
+#include <type_traits> // std::conditional, std::enable_if, std::integral_constant, std::is_same, std::is_void
+#include <utility>     // std::move
 
 #include <minesweeper/game.h>
+#include <minesweeper/type_traits.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
 namespace minesweeper {
 
+namespace detail {
+
+// reserves space for 'size' elements, if the container supports it
+template <class Container>
+void reserveIfPossible(Container& container, const std::size_t size, std::true_type /*hasReserve*/) {
+    container.reserve(static_cast<typename Container::size_type>(size));
+}
+
+template <class Container>
+void reserveIfPossible(Container& /*container*/, const std::size_t /*size*/, std::false_type /*hasReserve*/) {}
+
+template <class Container>
+void reserveIfPossible(Container& container, const std::size_t size) {
+    reserveIfPossible(container, size, has_reserve<Container>());
+}
+
+} // namespace detail
+
 template <class T>
 T Game::visualiseCell(const int x, const int y) const {
 
@@ -23,12 +47,37 @@ T Game::visualiseCell(const int x, const int y) const {
 
 template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
 Container Game::visualise() const {
-    return this->visualisationDetailIn1d_<Container>(&Game::visualiseCell_);
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
 }
 
 template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
 Container Game::visualise() const {
-    return this->visualisationDetailIn2d_<Container>(&Game::visualiseCell_);
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
+}
+
+template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
+Container Game::visualise(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL, x, y, width, height);
+}
+
+template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
+Container Game::visualise(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL, x, y, width, height);
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualise(OutputIterator output) const {
+    return this->visualisationDetailIn_<T>(VisualisationType::CELL, 0, this->_gridHeight * this->_gridWidth,
+                                           output);
+}
+
+template <class T>
+void Game::visualise(T* const buffer, const std::size_t bufferSize) const {
+    this->visualisationDetailInBuffer_(VisualisationType::CELL, buffer, bufferSize);
 }
 
 template <class T>
@@ -44,12 +93,37 @@ T Game::visualiseCellSolution(const int x, const int y) const {
 
 template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
 Container Game::visualiseSolution() const {
-    return this->visualisationDetailIn1d_<Container>(&Game::visualiseCellSolution_);
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL_SOLUTION, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
 }
 
 template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
 Container Game::visualiseSolution() const {
-    return this->visualisationDetailIn2d_<Container>(&Game::visualiseCellSolution_);
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL_SOLUTION, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
+}
+
+template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
+Container Game::visualiseSolution(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL_SOLUTION, x, y, width, height);
+}
+
+template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
+Container Game::visualiseSolution(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL_SOLUTION, x, y, width, height);
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualiseSolution(OutputIterator output) const {
+    return this->visualisationDetailIn_<T>(VisualisationType::CELL_SOLUTION, 0,
+                                           this->_gridHeight * this->_gridWidth, output);
+}
+
+template <class T>
+void Game::visualiseSolution(T* const buffer, const std::size_t bufferSize) const {
+    this->visualisationDetailInBuffer_(VisualisationType::CELL_SOLUTION, buffer, bufferSize);
 }
 
 template <class T>
@@ -65,44 +139,135 @@ T Game::visualiseCellSolutionData(const int x, const int y) const {
 
 template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
 Container Game::visualiseSolutionData() const {
-    return this->visualisationDetailIn1d_<Container>(&Game::visualiseCellSolutionData_);
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL_SOLUTION_DATA, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
 }
 
 template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
 Container Game::visualiseSolutionData() const {
-    return this->visualisationDetailIn2d_<Container>(&Game::visualiseCellSolutionData_);
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL_SOLUTION_DATA, 0, 0, this->_gridWidth,
+                                                     this->_gridHeight);
 }
 
-template <class Container>
-Container Game::visualisationDetailIn1d_(VisualMinesweeperCell (Game::*cellVisualisationMethod)(int, int) const) const {
+template <class Container, typename std::enable_if<is_expandable_1d_sequence_container<Container>::value, int>::type>
+Container Game::visualiseSolutionData(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn1d_<Container>(VisualisationType::CELL_SOLUTION_DATA, x, y, width, height);
+}
 
-    Container output;
-    using output_cell_data_type = typename Container::value_type;
+template <class Container, typename std::enable_if<is_expandable_2d_sequence_container<Container>::value, int>::type>
+Container Game::visualiseSolutionData(const int x, const int y, const int width, const int height) const {
+    verifyVisualisationArea_(x, y, width, height, this->_gridHeight, this->_gridWidth); // throws
+    return this->visualisationDetailIn2d_<Container>(VisualisationType::CELL_SOLUTION_DATA, x, y, width, height);
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualiseSolutionData(OutputIterator output) const {
+    return this->visualisationDetailIn_<T>(VisualisationType::CELL_SOLUTION_DATA, 0,
+                                           this->_gridHeight * this->_gridWidth, output);
+}
+
+template <class T>
+void Game::visualiseSolutionData(T* const buffer, const std::size_t bufferSize) const {
+    this->visualisationDetailInBuffer_(VisualisationType::CELL_SOLUTION_DATA, buffer, bufferSize);
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualisationDetailIn_(const VisualisationType visualisationType, const int firstCell,
+                                            const int numOfCells, OutputIterator output) const {
+
+    using Value = typename std::conditional<
+        std::is_void<T>::value, typename output_iterator_value_type<OutputIterator, VisualMinesweeperCell>::type,
+        T>::type;
+
+    // only buffers of types visualised by the library itself can be written straight into
+    using writesStraightIntoOutput =
+        std::integral_constant<bool, std::is_same<OutputIterator, Value*>::value &&
+                                         (std::is_same<Value, VisualMinesweeperCell>::value ||
+                                          std::is_same<Value, std::int8_t>::value)>;
+
+    return this->visualisationDetailIn_<Value>(visualisationType, firstCell, numOfCells, output,
+                                           writesStraightIntoOutput());
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualisationDetailIn_(const VisualisationType visualisationType, const int firstCell,
+                                            const int numOfCells, OutputIterator output,
+                                            std::true_type /*writesStraightIntoOutput*/) const {
+
+    this->visualiseCells_(visualisationType, firstCell, numOfCells, output);
+    return output + numOfCells;
+}
+
+template <class T, class OutputIterator>
+OutputIterator Game::visualisationDetailIn_(const VisualisationType visualisationType, const int firstCell,
+                                            const int numOfCells, OutputIterator output,
+                                            std::false_type /*writesStraightIntoOutput*/) const {
+
+    VisualMinesweeperCell chunk[VISUALISATION_CHUNK_SIZE];
+
+    for (int chunkStart = firstCell; chunkStart < firstCell + numOfCells; chunkStart += VISUALISATION_CHUNK_SIZE) {
 
-    for (int y = 0; y < this->_gridHeight; ++y) {
-        for (int x = 0; x < this->_gridWidth; ++x) {
+        const int chunkSize = firstCell + numOfCells - chunkStart < VISUALISATION_CHUNK_SIZE
+                                  ? firstCell + numOfCells - chunkStart
+                                  : VISUALISATION_CHUNK_SIZE;
+        this->visualiseCells_(visualisationType, chunkStart, chunkSize, chunk);
 
-            output.push_back(static_cast<output_cell_data_type>((this->*cellVisualisationMethod)(x, y)));
+        for (int i = 0; i < chunkSize; ++i) {
+            *output = static_cast<T>(chunk[i]);
+            ++output;
         }
     }
 
     return output;
 }
 
+template <class T>
+void Game::visualisationDetailInBuffer_(const VisualisationType visualisationType, T* const buffer,
+                                        const std::size_t bufferSize) const {
+
+    const int numOfCells = this->_gridHeight * this->_gridWidth;
+
+    if (bufferSize < static_cast<std::size_t>(numOfCells)) {
+        throw std::invalid_argument("Game::visualisationDetailInBuffer_(VisualisationType visualisationType, "
+                                    "T* buffer, std::size_t bufferSize): Trying to visualise " +
+                                    std::to_string(numOfCells) + " cells into a buffer of size " +
+                                    std::to_string(bufferSize) + ".");
+    }
+
+    this->visualisationDetailIn_<T>(visualisationType, 0, numOfCells, buffer);
+}
+
 template <class Container>
-Container Game::visualisationDetailIn2d_(VisualMinesweeperCell (Game::*cellVisualisationMethod)(int, int) const) const {
+Container Game::visualisationDetailIn1d_(const VisualisationType visualisationType, const int areaX, const int areaY,
+                                         const int areaWidth, const int areaHeight) const {
 
     Container output;
-    using output_cell_data_type = typename Container::value_type::value_type;
+    detail::reserveIfPossible(output, static_cast<std::size_t>(areaHeight) * areaWidth);
+
+    for (int y = areaY; y < areaY + areaHeight; ++y) {
+        this->visualisationDetailIn_<typename Container::value_type>(
+            visualisationType, y * this->_gridWidth + areaX, areaWidth, std::back_inserter(output));
+    }
 
-    for (int y = 0; y < this->_gridHeight; ++y) {
+    return output;
+}
+
+template <class Container>
+Container Game::visualisationDetailIn2d_(const VisualisationType visualisationType, const int areaX, const int areaY,
+                                         const int areaWidth, const int areaHeight) const {
+
+    Container output;
+    detail::reserveIfPossible(output, static_cast<std::size_t>(areaHeight));
+
+    for (int y = areaY; y < areaY + areaHeight; ++y) {
         typename Container::value_type outputRow;
-        for (int x = 0; x < this->_gridWidth; ++x) {
+        detail::reserveIfPossible(outputRow, static_cast<std::size_t>(areaWidth));
 
-            outputRow.push_back(static_cast<output_cell_data_type>((this->*cellVisualisationMethod)(x, y)));
-        }
+        this->visualisationDetailIn_<typename Container::value_type::value_type>(
+            visualisationType, y * this->_gridWidth + areaX, areaWidth, std::back_inserter(outputRow));
 
-        output.push_back(outputRow);
+        output.push_back(std::move(outputRow));
     }
 
     return output;
@@ -0,0 +1,33 @@
+#ifndef MINESWEEPER_GAME_STATS_H
+#define MINESWEEPER_GAME_STATS_H
+
+#include <cstdint> // std::uint64_t
+
+namespace minesweeper {
+
+// statistics of hot paths of a 'Game', since it was created or its statistics were reset:
+// (counted only if the library is built with 'MINESWEEPER_STATS' defined, otherwise every statistic stays 0)
+struct GameStats {
+    // cells revealed by checks and completions around cells (not by redone moves or loaded games)
+    std::uint64_t numOfCellsRevealed = 0;
+
+    // seeds of opening spans pushed into and popped from the stack of the scanline reveal engine,
+    // and popped seeds which had already been revealed as part of another span
+    std::uint64_t numOfOpeningSeedsPushed = 0;
+    std::uint64_t numOfOpeningSeedsPopped = 0;
+    std::uint64_t numOfDuplicateOpeningSeeds = 0;
+
+    // neighbours visited one by one (completing around cells, counting marks around cells and placing sparse mines)
+    std::uint64_t numOfNeighbourLookups = 0;
+
+    // mine layouts created, and the time taken to create them
+    std::uint64_t numOfMineGenerations = 0;
+    std::uint64_t mineGenerationNanoseconds = 0;
+
+    // bytes written by 'serialise' and 'serialiseDelta'
+    std::uint64_t numOfBytesSerialised = 0;
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_GAME_STATS_H
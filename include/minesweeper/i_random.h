@@ -10,6 +10,13 @@ class IRandom {
   public:
     virtual void shuffleVector(std::vector<int>& vec) = 0;
 
+    // chooses 'numOfChosen' distinct indices from [0, numOfIndices) which are not in (ascending) 'excludedIndices'
+    // into 'chosenIndices'
+    // (default implementation shuffles all indices using 'shuffleVector' and chooses the first non-excluded ones,
+    //  override this for a faster way that does not depend on 'numOfIndices')
+    virtual void chooseIndices(std::vector<int>& chosenIndices, int numOfChosen, int numOfIndices,
+                               const std::vector<int>& excludedIndices);
+
     virtual ~IRandom() = default;
 
     IRandom() = default;
@@ -20,4 +27,4 @@ class IRandom {
 };
 } // namespace minesweeper
 
-#endif // MINESWEEPER_I_RANDOM_H
\ No newline at end of file
+#endif // MINESWEEPER_I_RANDOM_H
@@ -0,0 +1,142 @@
+#ifndef MINESWEEPER_LATENCY_RECORDER_H
+#define MINESWEEPER_LATENCY_RECORDER_H
+
+#include <cstdint>  // std::uint8_t, std::uint64_t
+#include <iostream> // std::ostream
+#include <memory>   // std::unique_ptr
+#include <mutex>    // std::mutex
+#include <vector>   // std::vector
+
+namespace minesweeper {
+
+// operations of 'Game', whose latencies are recorded into 'LatencyRecorder':
+enum class LatencyOperation : std::uint8_t {
+    CHECK,           // checkInputCoordinates(x, y) (including mine generation of the first check)
+    COMPLETE_AROUND, // completeAroundInputCoordinates(x, y)
+    MINE_GENERATION  // creation of mines and numbers (by the first check, or by createMinesAndNums(x, y))
+};
+
+// classes of boards by their number of cells:
+enum class BoardSizeClass : std::uint8_t {
+    CLASSIC,   // up to 16 x 30 cells (beginner, intermediate and expert boards)
+    MEDIUM,    // up to 100 x 100 cells
+    LARGE,     // up to 1000 x 1000 cells
+    VERY_LARGE // more than 1000 x 1000 cells
+};
+
+// histogram of latencies (in nanoseconds) in logarithmic buckets, which are split into linear sub-buckets:
+// (latencies below 32 ns have a bucket each, larger latencies share a bucket with latencies less than 1/32
+// (about 3 %) apart from them, and latencies from about 78 hours up are counted into the last bucket)
+class LatencyHistogram {
+
+  public:
+    // +-----------------------+
+    // | public static fields: |
+    // +-----------------------+
+
+    static const int NUM_OF_BUCKETS;
+
+  private:
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    std::vector<std::uint64_t> _bucketCounts;
+    std::uint64_t _count = 0;
+    std::uint64_t _max = 0;
+
+    // merges histograms of threads straight into the fields
+    friend class LatencyRecorder;
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // constructor:
+    LatencyHistogram();
+
+    void record(std::uint64_t nanoseconds);
+    // adds latencies of 'other' into this histogram
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    // number of recorded latencies, and the largest one of them:
+    std::uint64_t count() const;
+    std::uint64_t max() const;
+
+    // largest latency of the bucket holding latency at 'percentile' (from 0 to 100) of recorded latencies
+    // (but no larger than the largest recorded latency, and 0 if nothing has been recorded)
+    std::uint64_t valueAtPercentile(double percentile) const;
+
+    const std::vector<std::uint64_t>& bucketCounts() const;
+
+    // bucket of latency, and the range of latencies in bucket:
+    static int bucketIndex(std::uint64_t nanoseconds);
+    static std::uint64_t lowestValueOfBucket(int bucketIndex);
+    static std::uint64_t highestValueOfBucket(int bucketIndex);
+
+    // writes the histogram as JSON object of its count, largest latency, percentiles 50, 99 and 99.9,
+    // and non-empty buckets (pairs of largest latency of the bucket and its count)
+    std::ostream& serialiseJson(std::ostream& outStream) const;
+};
+
+// records latencies of operations of games, which record into it, by operation and board size class:
+// (any number of threads can record at the same time: each thread records into histograms of its own
+// without locks, and these are merged when histograms are read, hence a game recording into the recorder
+// has to be destroyed or stop recording before the recorder is destroyed)
+class LatencyRecorder {
+
+  private:
+    // latency histograms of a thread (with counters written only by that thread)
+    struct ThreadHistograms;
+
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    // identifies the recorder in caches of threads (unlike its address, never reused)
+    std::uint64_t _id;
+
+    mutable std::mutex _threadHistogramsMutex;
+    std::vector<std::unique_ptr<ThreadHistograms>> _threadHistograms;
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // constructor:
+    LatencyRecorder();
+
+    LatencyRecorder(const LatencyRecorder& other) = delete;
+    LatencyRecorder& operator=(const LatencyRecorder& other) = delete;
+
+    // destructor:
+    ~LatencyRecorder();
+
+    void record(LatencyOperation operation, BoardSizeClass boardSizeClass, std::uint64_t nanoseconds);
+
+    // histogram merged from histograms of every thread, which has recorded into the recorder
+    LatencyHistogram histogram(LatencyOperation operation, BoardSizeClass boardSizeClass) const;
+
+    // forgets recorded latencies (latencies recorded at the same time might be kept)
+    void reset();
+
+    // writes merged histograms of every operation and board size class as JSON
+    std::ostream& serialiseJson(std::ostream& outStream) const;
+
+    static BoardSizeClass boardSizeClass(int gridHeight, int gridWidth);
+
+  private:
+    // +------------------+
+    // | private methods: |
+    // +------------------+
+
+    // histograms of the calling thread (registered on the first call from the thread)
+    ThreadHistograms& threadHistograms_();
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_LATENCY_RECORDER_H
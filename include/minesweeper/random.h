@@ -1,7 +1,7 @@
 #ifndef MINESWEEPER_RANDOM_H
 #define MINESWEEPER_RANDOM_H
 
-#include <random> // std::random_device, std::mt19937
+#include <random> // std::mt19937
 #include <vector> // std::vector
 
 #include <minesweeper/i_random.h>
@@ -11,14 +11,23 @@ namespace minesweeper {
 class Random : public IRandom {
 
   private:
-    std::random_device _rd;
     std::mt19937 _uRng;
 
   public:
+    // seeded by 'std::random_device'
     Random();
 
+    // explicitly seeded (avoids relatively slow 'std::random_device')
+    explicit Random(std::mt19937::result_type seed);
+
     void shuffleVector(std::vector<int>& vec) override;
+
+    // time taken depends only on 'numOfChosen' (and size of 'excludedIndices'),
+    // unless more than half of the non-excluded indices are chosen
+    // (chosen indices are not in random order)
+    void chooseIndices(std::vector<int>& chosenIndices, int numOfChosen, int numOfIndices,
+                       const std::vector<int>& excludedIndices) override;
 };
 } // namespace minesweeper
 
-#endif // MINESWEEPER_RANDOM_H
\ No newline at end of file
+#endif // MINESWEEPER_RANDOM_H
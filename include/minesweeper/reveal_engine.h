@@ -0,0 +1,14 @@
+#ifndef MINESWEEPER_REVEAL_ENGINE_H
+#define MINESWEEPER_REVEAL_ENGINE_H
+
+namespace minesweeper {
+
+// ways of revealing an opening (connected empty cells and the cells around them):
+enum class RevealEngine {
+    SCANLINE, // span by span flood fill over cells (default)
+    BITBOARD  // word-parallel dilation over bit planes of rows the opening reaches (for grids with large openings)
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_REVEAL_ENGINE_H
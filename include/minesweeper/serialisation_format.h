@@ -0,0 +1,17 @@
+#ifndef MINESWEEPER_SERIALISATION_FORMAT_H
+#define MINESWEEPER_SERIALISATION_FORMAT_H
+
+namespace minesweeper {
+
+// formats of 'Game' serialisation:
+enum class SerialisationFormat {
+    JSON,         // JSON indented with 4 spaces (default)
+    COMPACT_JSON, // same JSON without any whitespace
+    BINARY,       // header and bit planes of cells (recognised automatically when deserialising)
+    SEED_BASED    // binary header, generation seed, first checked cell and runs of cell states
+                  // (only for games whose mines have been created with a generation seed)
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_SERIALISATION_FORMAT_H
@@ -1,7 +1,8 @@
 #ifndef MINESWEEPER_TYPE_TRAITS_H
 #define MINESWEEPER_TYPE_TRAITS_H
 
-#include <type_traits> // std::enable_if, std::false_type, std::true_type
+#include <iterator>    // std::iterator_traits
+#include <type_traits> // std::conditional, std::enable_if, std::false_type, std::is_void, std::true_type
 #include <utility>     // std::declval
 
 namespace minesweeper {
@@ -41,6 +42,30 @@ struct is_expandable_2d_sequence_container<
                                is_expandable_1d_sequence_container<typename T::value_type>::value>::type>
     : std::true_type {};
 
+// template helper function to decide if type can reserve space for its elements
+// (eg. std::vector, std::string)
+template <typename, typename = void_t<>>
+struct has_reserve : std::false_type {};
+
+template <typename T>
+struct has_reserve<T, void_t<decltype(std::declval<T>().reserve(std::declval<typename T::size_type>()))>>
+    : std::true_type {};
+
+// template helper function to decide the type of values written through an output iterator
+// (value type of the iterator, or of the container of an insert iterator (whose value type is void),
+// or 'Default', if neither is known, eg. for std::ostream_iterator)
+template <typename OutputIterator, typename Default, typename = void_t<>>
+struct output_iterator_value_type {
+    using type = typename std::conditional<
+        std::is_void<typename std::iterator_traits<OutputIterator>::value_type>::value, Default,
+        typename std::iterator_traits<OutputIterator>::value_type>::type;
+};
+
+template <typename OutputIterator, typename Default>
+struct output_iterator_value_type<OutputIterator, Default, void_t<typename OutputIterator::container_type>> {
+    using type = typename OutputIterator::container_type::value_type;
+};
+
 } // namespace minesweeper
 
 #endif // MINESWEEPER_TYPE_TRAITS_H
\ No newline at end of file
@@ -0,0 +1,362 @@
+#include <algorithm>    // std::any_of, std::copy, std::equal, std::max, std::min
+#include <atomic>       // std::atomic
+#include <climits>      // INT_MAX
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint16_t, std::uint32_t, std::uint64_t
+#include <exception>    // std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <functional>   // std::function
+#include <iostream>     // std::istream, std::ostream, std::streamsize
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+#include <string>       // std::string, std::to_string
+#include <system_error> // std::system_error
+#include <thread>       // std::thread
+#include <vector>       // std::vector
+
+#include <minesweeper/action_log.h>
+#include <minesweeper/binary_encoding.h>
+#include <minesweeper/game.h>
+
+// binary action log (all numbers little-endian):
+//
+// header:
+//   bytes  0-3:  magic (0x89 'T' 'M' 'A')
+//   bytes  4-5:  version
+//   bytes  6-7:  flags (bit 0: generation seed)
+//   bytes  8-19: grid height, grid width and number of mines (32 bits each)
+//   bytes 20-27: generation seed (zero, if there is none)
+//   bytes 28-31: number of actions
+// records of actions (16 bytes each):
+//   byte   0:    action type
+//   byte   1:    flags (bit 0: keep created mines)
+//   bytes  2-3:  zero
+//   bytes  4-15: x and y, or grid height, grid width and number of mines (32 bits each, zero if unused)
+// followed by checksum of the header and the records (64 bits)
+
+namespace minesweeper {
+
+namespace {
+
+using binary_encoding::checksum;
+using binary_encoding::loadLittleEndian;
+using binary_encoding::storeLittleEndian;
+
+const unsigned char ACTION_LOG_MAGIC[4] = {0x89, 'T', 'M', 'A'};
+const std::uint16_t ACTION_LOG_VERSION = 1;
+
+const std::size_t ACTION_LOG_HEADER_SIZE = 32;
+const std::size_t ACTION_RECORD_SIZE = 16;
+const std::size_t ACTION_LOG_CHECKSUM_SIZE = 8;
+
+const std::uint16_t GENERATION_SEED_FLAG = 0x1;
+const unsigned char KEEP_CREATED_MINES_FLAG = 0x1;
+
+// records are read this many at a time, so that memory grows with the records actually read
+const std::size_t ACTION_RECORDS_READ_AT_A_TIME = 4096;
+
+// logs are handed out to replaying threads this many at a time
+const std::size_t LOGS_REPLAYED_AT_A_TIME = 16;
+
+bool usesCoordinates(const ActionType type) {
+    return type == ActionType::CHECK || type == ActionType::MARK || type == ActionType::COMPLETE_AROUND ||
+           type == ActionType::CREATE_MINES;
+}
+
+void storeAction(unsigned char* const output, const Action& action) {
+
+    output[0] = static_cast<unsigned char>(action.type);
+    output[1] = action.type == ActionType::RESET && action.keepCreatedMines ? KEEP_CREATED_MINES_FLAG : 0;
+    storeLittleEndian(output + 2, 0, 2);
+
+    std::uint32_t arguments[3] = {0, 0, 0};
+    if (usesCoordinates(action.type)) {
+        arguments[0] = static_cast<std::uint32_t>(action.x);
+        arguments[1] = static_cast<std::uint32_t>(action.y);
+    } else if (action.type == ActionType::NEW_GAME) {
+        arguments[0] = static_cast<std::uint32_t>(action.gridHeight);
+        arguments[1] = static_cast<std::uint32_t>(action.gridWidth);
+        arguments[2] = static_cast<std::uint32_t>(action.numOfMines);
+    }
+    for (int i = 0; i < 3; ++i) {
+        storeLittleEndian(output + 4 + 4 * i, arguments[i], 4);
+    }
+}
+
+// (returns false, if the record is not a valid action)
+bool loadAction(const unsigned char* const input, Action& action) {
+
+    if (input[0] > static_cast<unsigned char>(ActionType::NEW_GAME) || (input[1] & ~KEEP_CREATED_MINES_FLAG) != 0 ||
+        loadLittleEndian(input + 2, 2) != 0) {
+        return false;
+    }
+
+    std::uint64_t arguments[3];
+    for (int i = 0; i < 3; ++i) {
+        arguments[i] = loadLittleEndian(input + 4 + 4 * i, 4);
+        if (arguments[i] > INT_MAX) {
+            return false;
+        }
+    }
+
+    action = Action{static_cast<ActionType>(input[0]), 0, 0, false, 0, 0, 0};
+    if (usesCoordinates(action.type)) {
+        action.x = static_cast<int>(arguments[0]);
+        action.y = static_cast<int>(arguments[1]);
+    } else if (action.type == ActionType::NEW_GAME) {
+        action.gridHeight = static_cast<int>(arguments[0]);
+        action.gridWidth = static_cast<int>(arguments[1]);
+        action.numOfMines = static_cast<int>(arguments[2]);
+    } else if (action.type == ActionType::RESET) {
+        action.keepCreatedMines = (input[1] & KEEP_CREATED_MINES_FLAG) != 0;
+    }
+
+    // (unused arguments and flags have to be zero)
+    unsigned char record[ACTION_RECORD_SIZE];
+    storeAction(record, action);
+    return std::equal(record, record + ACTION_RECORD_SIZE, input);
+}
+
+} // namespace
+
+ActionLog::ActionLog(const int gridHeight, const int gridWidth, const int numOfMines)
+    : _gridHeight(gridHeight), _gridWidth(gridWidth), _numOfMines(numOfMines) {}
+
+void ActionLog::start(const int gridHeight, const int gridWidth, const int numOfMines) {
+    this->_gridHeight = gridHeight;
+    this->_gridWidth = gridWidth;
+    this->_numOfMines = numOfMines;
+    this->clearGenerationSeed();
+    this->_actions.clear();
+}
+
+int ActionLog::getGridHeight() const { return this->_gridHeight; }
+
+int ActionLog::getGridWidth() const { return this->_gridWidth; }
+
+int ActionLog::getNumOfMines() const { return this->_numOfMines; }
+
+void ActionLog::setGenerationSeed(const std::uint64_t seed) {
+    this->_hasGenerationSeed = true;
+    this->_generationSeed = seed;
+}
+
+void ActionLog::clearGenerationSeed() {
+    this->_hasGenerationSeed = false;
+    this->_generationSeed = 0;
+}
+
+bool ActionLog::hasGenerationSeed() const { return this->_hasGenerationSeed; }
+
+std::uint64_t ActionLog::getGenerationSeed() const { return this->_generationSeed; }
+
+void ActionLog::append(const Action& action) { this->_actions.push_back(action); }
+
+const std::vector<Action>& ActionLog::getActions() const { return this->_actions; }
+
+std::size_t ActionLog::numOfActions() const { return this->_actions.size(); }
+
+std::size_t ActionLog::serialisationSize() const {
+    return ACTION_LOG_HEADER_SIZE + this->_actions.size() * ACTION_RECORD_SIZE + ACTION_LOG_CHECKSUM_SIZE;
+}
+
+std::ostream& ActionLog::serialise(std::ostream& outStream) const {
+
+    std::vector<unsigned char> output(this->serialisationSize());
+
+    std::copy(ACTION_LOG_MAGIC, ACTION_LOG_MAGIC + 4, output.begin());
+    storeLittleEndian(&output[4], ACTION_LOG_VERSION, 2);
+    storeLittleEndian(&output[6], this->_hasGenerationSeed ? GENERATION_SEED_FLAG : 0, 2);
+    storeLittleEndian(&output[8], static_cast<std::uint32_t>(this->_gridHeight), 4);
+    storeLittleEndian(&output[12], static_cast<std::uint32_t>(this->_gridWidth), 4);
+    storeLittleEndian(&output[16], static_cast<std::uint32_t>(this->_numOfMines), 4);
+    storeLittleEndian(&output[20], this->_generationSeed, 8);
+    storeLittleEndian(&output[28], this->_actions.size(), 4);
+
+    unsigned char* record = &output[ACTION_LOG_HEADER_SIZE];
+    for (const Action& action : this->_actions) {
+        storeAction(record, action);
+        record += ACTION_RECORD_SIZE;
+    }
+
+    const std::size_t checksumOffset = output.size() - ACTION_LOG_CHECKSUM_SIZE;
+    storeLittleEndian(&output[checksumOffset], checksum(output.data(), checksumOffset), 8);
+
+    return outStream.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+}
+
+std::istream& ActionLog::deserialise(std::istream& inStream) {
+
+    const std::string errorPrefix = "ActionLog::deserialise(std::istream& inStream): ";
+
+    std::vector<unsigned char> input(ACTION_LOG_HEADER_SIZE);
+    if (!inStream.read(reinterpret_cast<char*>(input.data()), static_cast<std::streamsize>(input.size()))) {
+        throw std::invalid_argument(errorPrefix + "Action log ends before its header.");
+    }
+
+    if (!std::equal(ACTION_LOG_MAGIC, ACTION_LOG_MAGIC + 4, input.begin())) {
+        throw std::invalid_argument(errorPrefix + "Input is not an action log.");
+    }
+    const auto version = static_cast<std::uint16_t>(loadLittleEndian(&input[4], 2));
+    if (version != ACTION_LOG_VERSION) {
+        throw std::invalid_argument(errorPrefix + "Unsupported action log version (" + std::to_string(version) + ").");
+    }
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(&input[6], 2));
+    if ((flags & ~GENERATION_SEED_FLAG) != 0) {
+        throw std::invalid_argument(errorPrefix + "Unknown action log flags (" + std::to_string(flags) + ").");
+    }
+    const std::uint64_t gridHeight = loadLittleEndian(&input[8], 4);
+    const std::uint64_t gridWidth = loadLittleEndian(&input[12], 4);
+    const std::uint64_t numOfMines = loadLittleEndian(&input[16], 4);
+    if (gridHeight > INT_MAX || gridWidth > INT_MAX || numOfMines > INT_MAX) {
+        throw std::invalid_argument(errorPrefix + "Header of the action log describes an invalid game.");
+    }
+    const std::uint64_t generationSeed = loadLittleEndian(&input[20], 8);
+    const std::uint64_t numOfActions = loadLittleEndian(&input[28], 4);
+
+    // records and checksum
+    const std::size_t inputSize = ACTION_LOG_HEADER_SIZE + numOfActions * ACTION_RECORD_SIZE + ACTION_LOG_CHECKSUM_SIZE;
+    while (input.size() < inputSize) {
+        const std::size_t readSize =
+            std::min(inputSize - input.size(), ACTION_RECORDS_READ_AT_A_TIME * ACTION_RECORD_SIZE);
+        input.resize(input.size() + readSize);
+        if (!inStream.read(reinterpret_cast<char*>(&input[input.size() - readSize]),
+                           static_cast<std::streamsize>(readSize))) {
+            throw std::invalid_argument(errorPrefix + "Action log ends before all of its actions.");
+        }
+    }
+
+    const std::size_t checksumOffset = inputSize - ACTION_LOG_CHECKSUM_SIZE;
+    if (loadLittleEndian(&input[checksumOffset], 8) != checksum(input.data(), checksumOffset)) {
+        throw std::invalid_argument(errorPrefix + "Checksum of the action log does not match.");
+    }
+
+    std::vector<Action> actions(numOfActions);
+    for (std::size_t i = 0; i < actions.size(); ++i) {
+        if (!loadAction(&input[ACTION_LOG_HEADER_SIZE + i * ACTION_RECORD_SIZE], actions[i])) {
+            throw std::invalid_argument(errorPrefix + "Action " + std::to_string(i) + " is invalid.");
+        }
+    }
+
+    // log is changed only after the whole input has been verified
+    this->start(static_cast<int>(gridHeight), static_cast<int>(gridWidth), static_cast<int>(numOfMines));
+    if ((flags & GENERATION_SEED_FLAG) != 0) {
+        this->setGenerationSeed(generationSeed);
+    }
+    this->_actions.swap(actions);
+
+    return inStream;
+}
+
+void ActionLog::replay(Game& game) const {
+
+    if (this->_hasGenerationSeed) {
+        game.setGenerationSeed(this->_generationSeed);
+    } else {
+        game.clearGenerationSeed();
+    }
+
+    // (moves of the recorded game were undone or redone with its move journal enabled)
+    const bool hasUndoneOrRedoneMoves =
+        std::any_of(this->_actions.begin(), this->_actions.end(), [](const Action& action) {
+            return action.type == ActionType::UNDO || action.type == ActionType::REDO;
+        });
+    if (hasUndoneOrRedoneMoves) {
+        game.enableMoveJournal();
+    }
+
+    game.newGame(this->_gridHeight, this->_gridWidth, this->_numOfMines);
+
+    for (const Action& action : this->_actions) {
+        switch (action.type) {
+        case ActionType::CHECK:
+            game.checkInputCoordinates(action.x, action.y);
+            break;
+        case ActionType::MARK:
+            game.markInputCoordinates(action.x, action.y);
+            break;
+        case ActionType::COMPLETE_AROUND:
+            game.completeAroundInputCoordinates(action.x, action.y);
+            break;
+        case ActionType::CREATE_MINES:
+            game.createMinesAndNums(action.x, action.y);
+            break;
+        case ActionType::UNDO:
+            game.undoMove();
+            break;
+        case ActionType::REDO:
+            game.redoMove();
+            break;
+        case ActionType::RESET:
+            game.reset(action.keepCreatedMines);
+            break;
+        case ActionType::NEW_GAME:
+            game.newGame(action.gridHeight, action.gridWidth, action.numOfMines);
+            break;
+        }
+    }
+}
+
+// static method
+void ActionLog::replay(const std::vector<ActionLog>& logs,
+                       const std::function<void(std::size_t logIndex, const Game& game)>& onReplayed,
+                       unsigned numOfThreads) {
+
+    for (std::size_t i = 0; i < logs.size(); ++i) {
+        if (!logs[i].hasGenerationSeed()) {
+            throw std::invalid_argument("ActionLog::replay(const std::vector<ActionLog>& logs, "
+                                        "const std::function<void(std::size_t logIndex, const Game& game)>& "
+                                        "onReplayed, unsigned numOfThreads): Log " +
+                                        std::to_string(i) + " has no generation seed.");
+        }
+    }
+
+    if (numOfThreads == 0) {
+        numOfThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    const std::size_t numOfBatches = (logs.size() + LOGS_REPLAYED_AT_A_TIME - 1) / LOGS_REPLAYED_AT_A_TIME;
+    numOfThreads = static_cast<unsigned>(std::min<std::size_t>(numOfThreads, std::max<std::size_t>(numOfBatches, 1)));
+
+    // each thread replays batches of logs into a game of its own, until there are no batches left
+    // (first exception thrown by a replay or 'onReplayed' stops all threads, and it is rethrown afterwards)
+    std::atomic<std::size_t> nextBatch{0};
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto replayBatches = [&]() {
+        Game game;
+        try {
+            for (std::size_t batch = nextBatch++; batch < numOfBatches; batch = nextBatch++) {
+                const std::size_t endLog = std::min((batch + 1) * LOGS_REPLAYED_AT_A_TIME, logs.size());
+                for (std::size_t i = batch * LOGS_REPLAYED_AT_A_TIME; i < endLog; ++i) {
+                    logs[i].replay(game);
+                    onReplayed(i, game);
+                }
+            }
+        } catch (...) {
+            const std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (firstException == nullptr) {
+                firstException = std::current_exception();
+            }
+            nextBatch = numOfBatches;
+        }
+    };
+
+    // (calling thread replays too, and replays continue on fewer threads, if some can not be started)
+    std::vector<std::thread> threads;
+    try {
+        for (unsigned i = 1; i < numOfThreads; ++i) {
+            threads.emplace_back(replayBatches);
+        }
+    } catch (const std::system_error&) {
+    }
+    replayBatches();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    if (firstException != nullptr) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+} // namespace minesweeper
@@ -0,0 +1,43 @@
+#ifndef MINESWEEPER_BINARY_ENCODING_H
+#define MINESWEEPER_BINARY_ENCODING_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+
+// helpers shared by binary formats (saves of 'Game' and action logs)
+namespace minesweeper {
+namespace binary_encoding {
+
+// little-endian loads and stores (compiled into single moves on little-endian platforms)
+inline void storeLittleEndian(unsigned char* const output, const std::uint64_t value, const int numOfBytes) {
+    for (int i = 0; i < numOfBytes; ++i) {
+        output[i] = static_cast<unsigned char>(value >> (8U * static_cast<unsigned>(i)));
+    }
+}
+
+inline std::uint64_t loadLittleEndian(const unsigned char* const input, const int numOfBytes) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < numOfBytes; ++i) {
+        value |= std::uint64_t{input[i]} << (8U * static_cast<unsigned>(i));
+    }
+    return value;
+}
+
+// checksum of 'size' bytes, eight bytes at a time
+inline std::uint64_t checksum(const unsigned char* const input, const std::size_t size) {
+
+    const std::uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    std::uint64_t hash = size * MULTIPLIER;
+    for (std::size_t i = 0; i < size; i += 8) {
+        const int numOfBytes = size - i < 8 ? static_cast<int>(size - i) : 8;
+        hash = (hash ^ loadLittleEndian(input + i, numOfBytes)) * MULTIPLIER;
+        hash ^= hash >> 29U;
+    }
+    return hash;
+}
+
+} // namespace binary_encoding
+} // namespace minesweeper
+
+#endif // MINESWEEPER_BINARY_ENCODING_H
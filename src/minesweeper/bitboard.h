@@ -0,0 +1,133 @@
+#ifndef MINESWEEPER_BITBOARD_H
+#define MINESWEEPER_BITBOARD_H
+
+#include <cstdint> // std::uint64_t
+
+// helpers for rows of cells stored as bits of 64-bit words
+// (bit 'x % 64' of word 'x / 64' stands for column x)
+namespace minesweeper {
+namespace bitboard {
+
+using Word = std::uint64_t;
+
+const int WORD_BITS = 64;
+
+inline int numOfWords(const int numOfBits) { return (numOfBits + WORD_BITS - 1) / WORD_BITS; }
+
+inline Word reverseBits(Word word) {
+
+    word = ((word >> 1U) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1U);
+    word = ((word >> 2U) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2U);
+    word = ((word >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+    word = ((word >> 8U) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8U);
+    word = ((word >> 16U) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16U);
+    return (word >> 32U) | (word << 32U);
+}
+
+inline int countTrailingZeros(Word word) {
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int count = 0;
+    while ((word & 1U) == 0) {
+        word >>= 1U;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// fills the bits of 'mask' from each of its lowest bits in 'seeds' up to the end of the run of set bits
+// (adding a seed bit to its run carries through the rest of the run)
+inline Word fillRunsUpwards(const Word mask, const Word seeds) { return (((mask + seeds) ^ mask) & mask) | seeds; }
+
+// sets in 'output' every run of set bits in 'mask' that contains a set bit of 'seeds'
+// (runs may continue from one word to the next)
+inline void fillRuns(const Word* seeds, const Word* mask, Word* output, const int numOfWords) {
+
+    // towards higher columns, from the lowest seed of each run
+    Word carry = 0;
+    for (int i = 0; i < numOfWords; ++i) {
+        output[i] = fillRunsUpwards(mask[i], (seeds[i] | carry) & mask[i]);
+        carry = output[i] >> (WORD_BITS - 1);
+    }
+
+    // towards lower columns, from the highest seed of each run (same as above, but with reversed bits)
+    carry = 0;
+    for (int i = numOfWords - 1; i >= 0; --i) {
+        const Word reversedMask = reverseBits(mask[i]);
+        output[i] |= reverseBits(fillRunsUpwards(reversedMask, (reverseBits(seeds[i]) | carry) & reversedMask));
+        carry = output[i] & 1U;
+    }
+}
+
+// word 'i' of 'row' moved one column higher (bit x is set, if column x - 1 is set)
+inline Word leftNeighbours(const Word* row, const int i) {
+
+    return (row[i] << 1U) | (i > 0 ? row[i - 1] >> (WORD_BITS - 1) : 0);
+}
+
+// word 'i' of 'row' moved one column lower (bit x is set, if column x + 1 is set)
+inline Word rightNeighbours(const Word* row, const int i, const int numOfWords) {
+
+    return (row[i] >> 1U) | (i < numOfWords - 1 ? row[i + 1] << (WORD_BITS - 1) : 0);
+}
+
+// sets in 'output' every bit of 'row' together with its left and right neighbours
+inline void dilateRow(const Word* row, Word* output, const int numOfWords) {
+
+    for (int i = 0; i < numOfWords; ++i) {
+        output[i] = row[i] | leftNeighbours(row, i) | rightNeighbours(row, i, numOfWords);
+    }
+}
+
+// bit-sliced sum of three bit vectors: 'sum' gets ones and 'carry' twos of each column
+inline void fullAdd(const Word a, const Word b, const Word c, Word& sum, Word& carry) {
+
+    const Word partialSum = a ^ b;
+    sum = partialSum ^ c;
+    carry = (a & b) | (partialSum & c);
+}
+
+// bit-sliced number of set neighbours (0-8) of each column of word 'i' of 'middle' row,
+// given as four bit vectors of ones, twos, fours and eights
+// ('above' and 'below' rows may be null at the edges of the grid)
+inline void countNeighbours(const Word* above, const Word* middle, const Word* below, const int i,
+                            const int numOfWords, Word (&count)[4]) {
+
+    // horizontal sums of three cells above and below, and two cells on the sides
+    Word aboveOnes = 0;
+    Word aboveTwos = 0;
+    if (above != nullptr) {
+        fullAdd(leftNeighbours(above, i), above[i], rightNeighbours(above, i, numOfWords), aboveOnes, aboveTwos);
+    }
+    Word belowOnes = 0;
+    Word belowTwos = 0;
+    if (below != nullptr) {
+        fullAdd(leftNeighbours(below, i), below[i], rightNeighbours(below, i, numOfWords), belowOnes, belowTwos);
+    }
+    const Word middleLeft = leftNeighbours(middle, i);
+    const Word middleRight = rightNeighbours(middle, i, numOfWords);
+    const Word sideOnes = middleLeft ^ middleRight;
+    const Word sideTwos = middleLeft & middleRight;
+
+    // adding horizontal sums together
+    Word ones = 0;
+    Word onesCarry = 0;
+    fullAdd(aboveOnes, belowOnes, sideOnes, ones, onesCarry);
+    Word twos = 0;
+    Word twosCarry = 0;
+    fullAdd(aboveTwos, belowTwos, sideTwos, twos, twosCarry);
+
+    count[0] = ones;
+    count[1] = twos ^ onesCarry;
+    const Word fours = twos & onesCarry;
+    count[2] = twosCarry ^ fours;
+    count[3] = twosCarry & fours;
+}
+
+} // namespace bitboard
+} // namespace minesweeper
+
+#endif // MINESWEEPER_BITBOARD_H
@@ -1,16 +1,128 @@
+#include <algorithm> // std::min
 #include <cassert>   // assert
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int8_t, std::uint8_t, std::uint64_t
+#include <cstring>   // std::memcpy
 #include <iomanip>   // std::setw
 #include <iostream>  // std::istream, std::ostream
 #include <stdexcept> // std::invalid_argument
-#include <string>    // std::string
+#include <string>    // std::string, std::to_string
 
 #include <json.hpp> // nlohmann::json
 
 #include <minesweeper/cell.h>
+#include <minesweeper/json_stream_writer.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
 namespace minesweeper {
 
+namespace {
+
+// +-----------------------+
+// | cell state bit masks: |
+// +-----------------------+
+
+constexpr std::uint8_t NUM_OF_MINES_AROUND_MASK = 0x0F;
+constexpr std::uint8_t HAS_MINE_BIT = 0x10;
+constexpr std::uint8_t IS_VISIBLE_BIT = 0x20;
+constexpr std::uint8_t IS_MARKED_BIT = 0x40;
+constexpr std::uint8_t IS_BORDER_BIT = 0x80;
+
+// bits of the cell state that affect its visualisation
+constexpr std::uint8_t VISUALISATION_STATE_MASK = 0x7F;
+constexpr std::size_t NUM_OF_VISUALISATION_STATES = VISUALISATION_STATE_MASK + 1;
+
+// whether the lowest byte of an integer is stored first (cells can then be written eight at a time)
+bool isLittleEndian() {
+
+    const std::uint16_t one = 1;
+    unsigned char firstByte = 0;
+    std::memcpy(&firstByte, &one, 1);
+    return firstByte == 1;
+}
+
+// spreads the lowest eight bits of 'bits' to the lowest bits of eight bytes
+// (replicated to every byte, bit k kept in byte k and made the lowest bit of the byte)
+std::uint64_t spreadBits(const std::uint64_t bits) {
+    return ((((bits & 0xFFU) * 0x0101010101010101ULL) & 0x8040201008040201ULL) + 0x7F7F7F7F7F7F7F7FULL) >> 7U &
+           0x0101010101010101ULL;
+}
+
+// gathers the lowest bits of eight bytes into eight bits (inverse of 'spreadBits')
+std::uint64_t gatherBits(const std::uint64_t bytes) {
+    return ((bytes & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56U;
+}
+
+// +------------------------------+
+// | visualisation lookup tables: |
+// +------------------------------+
+
+// visualisation of every possible (packed) cell state
+struct visualisation_table {
+    VisualMinesweeperCell entries[NUM_OF_VISUALISATION_STATES];
+};
+
+constexpr VisualMinesweeperCell visualiseState(const std::uint8_t state) {
+
+    VisualMinesweeperCell output = VisualMinesweeperCell::UNCHECKED;
+    if ((state & IS_MARKED_BIT) != 0) {
+        output = VisualMinesweeperCell::MARKED;
+    } else if ((state & IS_VISIBLE_BIT) == 0) {
+        output = VisualMinesweeperCell::UNCHECKED;
+    } else {
+        if ((state & HAS_MINE_BIT) != 0) {
+            output = VisualMinesweeperCell::MINE;
+        } else {
+            output = static_cast<VisualMinesweeperCell>(state & NUM_OF_MINES_AROUND_MASK);
+        }
+    }
+
+    return output;
+}
+
+constexpr VisualMinesweeperCell visualiseStateSolution(const std::uint8_t state) {
+
+    VisualMinesweeperCell output = VisualMinesweeperCell::MARKED;
+    if ((state & HAS_MINE_BIT) != 0) {
+        output = VisualMinesweeperCell::MARKED;
+    } else {
+        output = static_cast<VisualMinesweeperCell>(state & NUM_OF_MINES_AROUND_MASK);
+    }
+
+    return output;
+}
+
+constexpr VisualMinesweeperCell visualiseStateSolutionData(const std::uint8_t state) {
+
+    VisualMinesweeperCell output = VisualMinesweeperCell::MINE;
+    if ((state & HAS_MINE_BIT) != 0) {
+        output = VisualMinesweeperCell::MINE;
+    } else {
+        output = static_cast<VisualMinesweeperCell>(state & NUM_OF_MINES_AROUND_MASK);
+    }
+
+    return output;
+}
+
+constexpr visualisation_table makeVisualisationTable(VisualMinesweeperCell (*visualiseStateFunction)(std::uint8_t)) {
+
+    visualisation_table table{};
+    for (std::size_t state = 0; state < NUM_OF_VISUALISATION_STATES; ++state) {
+        table.entries[state] = visualiseStateFunction(static_cast<std::uint8_t>(state));
+    }
+
+    return table;
+}
+
+constexpr visualisation_table VISUALISE_TABLE = makeVisualisationTable(visualiseState);
+constexpr visualisation_table VISUALISE_SOLUTION_TABLE = makeVisualisationTable(visualiseStateSolution);
+constexpr visualisation_table VISUALISE_SOLUTION_DATA_TABLE = makeVisualisationTable(visualiseStateSolutionData);
+
+} // namespace
+
+// every cell is expected to fit in a single byte
+static_assert(sizeof(Cell) == 1, "Cell is expected to be packed into a single byte.");
+
 // +----------------------------------+
 // | initialisation of static fields: |
 // +----------------------------------+
@@ -27,44 +139,174 @@ const char* Cell::NUM_OF_MINES_AROUND_KEY = "_numOfMinesAround";
 // | methods: |
 // +----------+
 
-bool Cell::isVisible() const { return this->_isVisible; }
+bool Cell::isVisible() const { return (this->_state & IS_VISIBLE_BIT) != 0; }
 
-bool Cell::hasMine() const { return this->_hasMine; }
+bool Cell::hasMine() const { return (this->_state & HAS_MINE_BIT) != 0; }
 
-bool Cell::isMarked() const { return this->_isMarked; }
+bool Cell::isMarked() const { return (this->_state & IS_MARKED_BIT) != 0; }
 
-int Cell::numOfMinesAround() const { return this->_numOfMinesAround; }
+int Cell::numOfMinesAround() const { return this->_state & NUM_OF_MINES_AROUND_MASK; }
 
 void Cell::incrNumOfMinesAround() {
 
-    ++(this->_numOfMinesAround);
-    assert(this->_numOfMinesAround >= 0 && this->_numOfMinesAround < 9);
+    assert(this->numOfMinesAround() >= 0 && this->numOfMinesAround() < 8);
+    ++(this->_state);
+}
+
+// static method
+void Cell::setNumsOfMinesAround(Cell* const cells, const std::uint64_t (&numBits)[4], const int numOfCells) {
+
+    assert(numOfCells >= 0 && numOfCells <= 64);
+
+    // eight cells at a time: bits of a byte are spread to one bit per byte
+    for (int firstCell = 0; firstCell < numOfCells; firstCell += 8) {
+        const auto shift = static_cast<unsigned>(firstCell);
+        const std::uint64_t numsOfMinesAround =
+            spreadBits(numBits[0] >> shift) | (spreadBits(numBits[1] >> shift) << 1U) |
+            (spreadBits(numBits[2] >> shift) << 2U) | (spreadBits(numBits[3] >> shift) << 3U);
+
+        Cell* const group = cells + firstCell;
+        if (numOfCells - firstCell >= 8 && isLittleEndian()) {
+            // whole group of (single byte) cells at once
+            std::uint64_t states = 0;
+            std::memcpy(&states, group, sizeof(states));
+            states = (states & ~(NUM_OF_MINES_AROUND_MASK * 0x0101010101010101ULL)) | numsOfMinesAround;
+            // (copied as bytes, since 'Cell' is trivially copyable, but its default member initialiser makes its
+            // default constructor non-trivial, for which copying into 'Cell*' warns with -Wclass-memaccess)
+            std::memcpy(reinterpret_cast<unsigned char*>(group), &states, sizeof(states));
+        } else {
+            const int groupSize = std::min(8, numOfCells - firstCell);
+            for (int i = 0; i < groupSize; ++i) {
+                const auto numOfMinesAround =
+                    static_cast<std::uint8_t>(numsOfMinesAround >> (8U * static_cast<unsigned>(i)));
+                group[i]._state =
+                    static_cast<std::uint8_t>((group[i]._state & ~NUM_OF_MINES_AROUND_MASK) | numOfMinesAround);
+            }
+        }
+    }
+}
+
+void Cell::bitPlanes(const Cell* const cells, const int numOfCells, std::uint64_t& visibleBits,
+                     std::uint64_t& mineBits, std::uint64_t& markedBits) {
+
+    assert(numOfCells >= 0 && numOfCells <= 64);
+
+    visibleBits = 0;
+    mineBits = 0;
+    markedBits = 0;
+
+    // eight cells at a time: one bit per byte is gathered into a byte
+    for (int firstCell = 0; firstCell < numOfCells; firstCell += 8) {
+        const int groupSize = std::min(8, numOfCells - firstCell);
+
+        std::uint64_t states = 0;
+        if (groupSize == 8 && isLittleEndian()) {
+            std::memcpy(&states, cells + firstCell, sizeof(states));
+        } else {
+            for (int i = 0; i < groupSize; ++i) {
+                states |= std::uint64_t{cells[firstCell + i]._state} << (8U * static_cast<unsigned>(i));
+            }
+        }
+
+        const auto shift = static_cast<unsigned>(firstCell);
+        visibleBits |= gatherBits(states >> 5U) << shift;
+        mineBits |= gatherBits(states >> 4U) << shift;
+        markedBits |= gatherBits(states >> 6U) << shift;
+    }
+}
+
+void Cell::openingBitPlanes(const Cell* const cells, const int numOfCells, std::uint64_t& hiddenBits,
+                            std::uint64_t& opensAroundBits) {
+
+    assert(numOfCells >= 0 && numOfCells <= 64);
+
+    hiddenBits = 0;
+    opensAroundBits = 0;
+
+    // eight cells at a time, like above
+    for (int firstCell = 0; firstCell < numOfCells; firstCell += 8) {
+        const int groupSize = std::min(8, numOfCells - firstCell);
+
+        std::uint64_t states = 0;
+        if (groupSize == 8 && isLittleEndian()) {
+            std::memcpy(&states, cells + firstCell, sizeof(states));
+        } else {
+            for (int i = 0; i < groupSize; ++i) {
+                states |= std::uint64_t{cells[firstCell + i]._state} << (8U * static_cast<unsigned>(i));
+            }
+        }
+
+        // (highest bit of a byte is set by the addition, if the cell has a mine or mines around it)
+        const std::uint64_t hasMineOrNumber =
+            ((states & ((HAS_MINE_BIT | NUM_OF_MINES_AROUND_MASK) * 0x0101010101010101ULL)) + 0x7F7F7F7F7F7F7F7FULL) >>
+            7U;
+        const std::uint64_t hidden = gatherBits(~((states >> 5U) | (states >> 6U)));
+
+        const auto shift = static_cast<unsigned>(firstCell);
+        hiddenBits |= hidden << shift;
+        opensAroundBits |= (hidden & gatherBits(~hasMineOrNumber)) << shift;
+    }
+
+    // (missing cells of the last group would otherwise look hidden)
+    if (numOfCells < 64) {
+        const std::uint64_t cellsMask = (std::uint64_t{1} << static_cast<unsigned>(numOfCells)) - 1;
+        hiddenBits &= cellsMask;
+        opensAroundBits &= cellsMask;
+    }
+}
+
+void Cell::setFromBitPlanes(Cell* const cells, const int numOfCells, const std::uint64_t visibleBits,
+                            const std::uint64_t mineBits, const std::uint64_t markedBits) {
+
+    assert(numOfCells >= 0 && numOfCells <= 64);
+
+    // eight cells at a time: bits of a byte are spread to one bit per byte
+    for (int firstCell = 0; firstCell < numOfCells; firstCell += 8) {
+        const auto shift = static_cast<unsigned>(firstCell);
+        const std::uint64_t states = (spreadBits(visibleBits >> shift) << 5U) | (spreadBits(mineBits >> shift) << 4U) |
+                                     (spreadBits(markedBits >> shift) << 6U);
+
+        Cell* const group = cells + firstCell;
+        if (numOfCells - firstCell >= 8 && isLittleEndian()) {
+            // (copied as bytes because of the non-trivial default constructor, as in 'setNumsOfMinesAround')
+            std::memcpy(reinterpret_cast<unsigned char*>(group), &states, sizeof(states));
+        } else {
+            const int groupSize = std::min(8, numOfCells - firstCell);
+            for (int i = 0; i < groupSize; ++i) {
+                group[i]._state = static_cast<std::uint8_t>(states >> (8U * static_cast<unsigned>(i)));
+            }
+        }
+    }
 }
 
-void Cell::makeVisible() { this->_isVisible = true; }
+void Cell::makeVisible() { this->_state |= IS_VISIBLE_BIT; }
+
+void Cell::makeHidden() { this->_state &= static_cast<std::uint8_t>(~IS_VISIBLE_BIT); }
 
-void Cell::putMine() { this->_hasMine = true; }
+void Cell::putMine() { this->_state |= HAS_MINE_BIT; }
 
 void Cell::markCell() {
 
-    assert(this->_isMarked != true);
-    this->_isMarked = true;
+    assert(!this->isMarked());
+    this->_state |= IS_MARKED_BIT;
 }
 
 void Cell::unmarkCell() {
 
-    assert(this->_isMarked != false);
-    this->_isMarked = false;
+    assert(this->isMarked());
+    this->_state &= static_cast<std::uint8_t>(~IS_MARKED_BIT);
 }
 
-void Cell::reset(bool keepMineInformation) {
+void Cell::makeBorder() { this->_state = IS_BORDER_BIT | IS_VISIBLE_BIT; }
+
+bool Cell::isBorder() const { return (this->_state & IS_BORDER_BIT) != 0; }
 
-    this->_isVisible = false;
-    this->_isMarked = false;
+void Cell::reset(bool keepMineInformation) {
 
-    if (!keepMineInformation) {
-        this->_hasMine = false;
-        this->_numOfMinesAround = 0;
+    if (keepMineInformation) {
+        this->_state &= (HAS_MINE_BIT | NUM_OF_MINES_AROUND_MASK);
+    } else {
+        this->_state = 0;
     }
 }
 
@@ -79,6 +321,26 @@ std::ostream& Cell::serialise(std::ostream& outStream) const {
 
 nlohmann::json Cell::serialise() const { return this->serialise_(); }
 
+void Cell::serialise(JsonStreamWriter& writer) const {
+
+    // current serialisation keys:
+    const std::string CURRENT_CELL_VERSION = "1.0";
+
+    // (keys in sorted order, like in 'serialise_')
+    writer.beginObject();
+    writer.key(HAS_MINE_KEY);
+    writer.value(this->hasMine());
+    writer.key(IS_MARKED_KEY);
+    writer.value(this->isMarked());
+    writer.key(IS_VISIBLE_KEY);
+    writer.value(this->isVisible());
+    writer.key(NUM_OF_MINES_AROUND_KEY);
+    writer.value(this->numOfMinesAround());
+    writer.key(CELL_VERSION_KEY);
+    writer.value(CURRENT_CELL_VERSION);
+    writer.endObject();
+}
+
 nlohmann::json Cell::serialise_() const {
 
     // current serialisation keys:
@@ -90,10 +352,10 @@ nlohmann::json Cell::serialise_() const {
     j[CELL_VERSION_KEY] = CURRENT_CELL_VERSION;
 
     // cell fields
-    j[IS_VISIBLE_KEY] = this->_isVisible;
-    j[HAS_MINE_KEY] = this->_hasMine;
-    j[IS_MARKED_KEY] = this->_isMarked;
-    j[NUM_OF_MINES_AROUND_KEY] = this->_numOfMinesAround;
+    j[IS_VISIBLE_KEY] = this->isVisible();
+    j[HAS_MINE_KEY] = this->hasMine();
+    j[IS_MARKED_KEY] = this->isMarked();
+    j[NUM_OF_MINES_AROUND_KEY] = this->numOfMinesAround();
 
     return j;
 }
@@ -117,6 +379,20 @@ std::istream& Cell::deserialise(std::istream& inStream) {
 
 void Cell::deserialise(const nlohmann::json& j) { this->deserialise_(j); }
 
+void Cell::deserialise(const bool isVisible, const bool hasMine, const bool isMarked, const int numOfMinesAround) {
+
+    if (numOfMinesAround < 0 || numOfMinesAround > 8) {
+        throw std::invalid_argument("Cell::deserialise(bool isVisible, bool hasMine, bool isMarked, "
+                                    "int numOfMinesAround): Invalid number of mines around: " +
+                                    std::to_string(numOfMinesAround));
+    }
+
+    this->_state = static_cast<std::uint8_t>(numOfMinesAround);
+    this->_state |= hasMine ? HAS_MINE_BIT : 0;
+    this->_state |= isVisible ? IS_VISIBLE_BIT : 0;
+    this->_state |= isMarked ? IS_MARKED_BIT : 0;
+}
+
 void Cell::deserialise_(const nlohmann::json& j) {
 
     // current serialisation keys:
@@ -127,10 +403,12 @@ void Cell::deserialise_(const nlohmann::json& j) {
         if (j.at(CELL_VERSION_KEY) == CURRENT_CELL_VERSION) {
 
             // cell fields
-            this->_isVisible = j.at(IS_VISIBLE_KEY);
-            this->_hasMine = j.at(HAS_MINE_KEY);
-            this->_isMarked = j.at(IS_MARKED_KEY);
-            this->_numOfMinesAround = j.at(NUM_OF_MINES_AROUND_KEY);
+            const bool newIsVisible = j.at(IS_VISIBLE_KEY);
+            const bool newHasMine = j.at(HAS_MINE_KEY);
+            const bool newIsMarked = j.at(IS_MARKED_KEY);
+            const int newNumOfMinesAround = j.at(NUM_OF_MINES_AROUND_KEY);
+
+            this->deserialise(newIsVisible, newHasMine, newIsMarked, newNumOfMinesAround);
         }
 
     } catch (nlohmann::json::type_error& ex) {
@@ -143,45 +421,46 @@ void Cell::deserialise_(const nlohmann::json& j) {
 }
 
 VisualMinesweeperCell Cell::visualise() const {
-
-    VisualMinesweeperCell output;
-    if (this->_isMarked) {
-        output = VisualMinesweeperCell::MARKED;
-    } else if (!this->_isVisible) {
-        output = VisualMinesweeperCell::UNCHECKED;
-    } else {
-        if (this->_hasMine) {
-            output = VisualMinesweeperCell::MINE;
-        } else {
-            output = static_cast<VisualMinesweeperCell>(this->_numOfMinesAround);
-        }
-    }
-
-    return output;
+    return VISUALISE_TABLE.entries[this->_state & VISUALISATION_STATE_MASK];
 }
 
 VisualMinesweeperCell Cell::visualiseSolution() const {
-
-    VisualMinesweeperCell output;
-    if (this->_hasMine) {
-        output = VisualMinesweeperCell::MARKED;
-    } else {
-        output = static_cast<VisualMinesweeperCell>(this->_numOfMinesAround);
-    }
-
-    return output;
+    return VISUALISE_SOLUTION_TABLE.entries[this->_state & VISUALISATION_STATE_MASK];
 }
 
 VisualMinesweeperCell Cell::visualiseSolutionData() const {
+    return VISUALISE_SOLUTION_DATA_TABLE.entries[this->_state & VISUALISATION_STATE_MASK];
+}
 
-    VisualMinesweeperCell output;
-    if (this->_hasMine) {
-        output = VisualMinesweeperCell::MINE;
-    } else {
-        output = static_cast<VisualMinesweeperCell>(this->_numOfMinesAround);
+// static method
+template <class T>
+void Cell::visualise(const Cell* const cells, const int numOfCells, T* const output) {
+    for (int i = 0; i < numOfCells; ++i) {
+        output[i] = static_cast<T>(VISUALISE_TABLE.entries[cells[i]._state & VISUALISATION_STATE_MASK]);
     }
+}
 
-    return output;
+// static method
+template <class T>
+void Cell::visualiseSolution(const Cell* const cells, const int numOfCells, T* const output) {
+    for (int i = 0; i < numOfCells; ++i) {
+        output[i] = static_cast<T>(VISUALISE_SOLUTION_TABLE.entries[cells[i]._state & VISUALISATION_STATE_MASK]);
+    }
 }
 
-} // namespace minesweeper
\ No newline at end of file
+// static method
+template <class T>
+void Cell::visualiseSolutionData(const Cell* const cells, const int numOfCells, T* const output) {
+    for (int i = 0; i < numOfCells; ++i) {
+        output[i] = static_cast<T>(VISUALISE_SOLUTION_DATA_TABLE.entries[cells[i]._state & VISUALISATION_STATE_MASK]);
+    }
+}
+
+template void Cell::visualise(const Cell* cells, int numOfCells, VisualMinesweeperCell* output);
+template void Cell::visualise(const Cell* cells, int numOfCells, std::int8_t* output);
+template void Cell::visualiseSolution(const Cell* cells, int numOfCells, VisualMinesweeperCell* output);
+template void Cell::visualiseSolution(const Cell* cells, int numOfCells, std::int8_t* output);
+template void Cell::visualiseSolutionData(const Cell* cells, int numOfCells, VisualMinesweeperCell* output);
+template void Cell::visualiseSolutionData(const Cell* cells, int numOfCells, std::int8_t* output);
+
+} // namespace minesweeper
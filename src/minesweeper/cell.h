@@ -1,10 +1,12 @@
 #ifndef MINESWEEPER_CELL_H
 #define MINESWEEPER_CELL_H
 
+#include <cstdint>  // std::uint8_t, std::uint64_t
 #include <iostream> // std::istream, std::ostream
 
 #include <json.hpp> // nlohmann::json
 
+#include <minesweeper/json_stream_writer.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
 namespace minesweeper {
@@ -15,10 +17,9 @@ class Cell {
     // | fields: |
     // +---------+
 
-    bool _isVisible = false;
-    bool _hasMine = false;
-    bool _isMarked = false;
-    int _numOfMinesAround = 0;
+    // packed cell state (see state bit masks in 'cell.cpp'):
+    // bits 0-3: number of mines around, bit 4: has mine, bit 5: is visible, bit 6: is marked, bit 7: is border
+    std::uint8_t _state = 0;
 
   public:
     // +-----------------+
@@ -49,21 +50,43 @@ class Cell {
     // cell mine creation methods:
     void putMine();
     void incrNumOfMinesAround();
-
-    // cell checking method:
+    // (sets numbers for up to 64 consecutive cells at once, bit i of 'numBits[b]' being bit b of the number of cell i)
+    static void setNumsOfMinesAround(Cell* cells, const std::uint64_t (&numBits)[4], int numOfCells);
+
+    // bit plane methods for up to 64 consecutive cells (bit i of each plane being cell i):
+    static void bitPlanes(const Cell* cells, int numOfCells, std::uint64_t& visibleBits, std::uint64_t& mineBits,
+                          std::uint64_t& markedBits);
+    // (hidden cells are neither visible nor marked, and hidden cells which open around also have no mine
+    // and no mines around them)
+    static void openingBitPlanes(const Cell* cells, int numOfCells, std::uint64_t& hiddenBits,
+                                 std::uint64_t& opensAroundBits);
+    // (numbers of mines around are cleared)
+    static void setFromBitPlanes(Cell* cells, int numOfCells, std::uint64_t visibleBits, std::uint64_t mineBits,
+                                 std::uint64_t markedBits);
+
+    // cell checking methods:
     void makeVisible();
+    // (only for undoing a check)
+    void makeHidden();
 
     // cell marking methods:
     void markCell();
     void unmarkCell();
 
+    // border (sentinel) cell methods:
+    // (border cells surround the grid and are always visible, so that they are never checked)
+    void makeBorder();
+    bool isBorder() const;
+
     // save cell:
     std::ostream& serialise(std::ostream& outStream) const;
     nlohmann::json serialise() const;
+    void serialise(JsonStreamWriter& writer) const;
 
     // load cell:
     std::istream& deserialise(std::istream& inStream);
     void deserialise(const nlohmann::json& j);
+    void deserialise(bool isVisible, bool hasMine, bool isMarked, int numOfMinesAround);
 
     // visualise as 'VisualMinesweeperCell' -method
     VisualMinesweeperCell visualise() const;
@@ -74,12 +97,20 @@ class Cell {
     // visualise solution data as 'VisualMinesweeperCell' -method
     VisualMinesweeperCell visualiseSolutionData() const;
 
-  private:
+    // visualise consecutive cells at once into 'output' -methods
+    // (for 'VisualMinesweeperCell' and 'std::int8_t' outputs)
+    template <class T>
+    static void visualise(const Cell* cells, int numOfCells, T* output);
+    template <class T>
+    static void visualiseSolution(const Cell* cells, int numOfCells, T* output);
+    template <class T>
+    static void visualiseSolutionData(const Cell* cells, int numOfCells, T* output);
+
     // +----------------------+
     // | static const fields: |
     // +----------------------+
 
-    // serialisation keys:
+    // serialisation keys (public for streaming 'Game' deserialisation):
     static const char* CELL_VERSION_KEY;
     // basic serialisation structure keys:
     static const char* IS_VISIBLE_KEY;
@@ -87,6 +118,7 @@ class Cell {
     static const char* IS_MARKED_KEY;
     static const char* NUM_OF_MINES_AROUND_KEY;
 
+  private:
     // +------------------+
     // | private methods: |
     // +------------------+
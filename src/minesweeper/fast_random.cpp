@@ -0,0 +1,104 @@
+#include <cassert>   // assert
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <limits>    // std::numeric_limits
+#include <random>    // std::random_device
+#include <utility>   // std::swap
+#include <vector>    // std::vector
+
+#include <minesweeper/fast_random.h>
+#include <minesweeper/sampling.h>
+
+namespace minesweeper {
+
+namespace {
+
+std::uint64_t rotl(const std::uint64_t x, const int k) { return (x << k) | (x >> (64 - k)); }
+
+// used to expand a single seed into the whole generator state
+std::uint64_t splitMix64(std::uint64_t& x) {
+
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27U)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31U);
+}
+
+} // namespace
+
+FastRandom::FastRandom() {
+
+    std::random_device rd;
+    this->seed((static_cast<std::uint64_t>(rd()) << 32U) ^ rd());
+}
+
+FastRandom::FastRandom(const std::uint64_t seed) { this->seed(seed); }
+
+void FastRandom::seed(std::uint64_t seed) {
+
+    for (auto& stateWord : this->_state) {
+        stateWord = splitMix64(seed);
+    }
+}
+
+// xoshiro256** by David Blackman and Sebastiano Vigna
+FastRandom::result_type FastRandom::operator()() {
+
+    const std::uint64_t result = rotl(this->_state[1] * 5, 7) * 9;
+    const std::uint64_t t = this->_state[1] << 17U;
+
+    this->_state[2] ^= this->_state[0];
+    this->_state[3] ^= this->_state[1];
+    this->_state[1] ^= this->_state[2];
+    this->_state[0] ^= this->_state[3];
+
+    this->_state[2] ^= t;
+    this->_state[3] = rotl(this->_state[3], 45);
+
+    return result;
+}
+
+// Daniel Lemire's nearly divisionless method
+std::uint32_t FastRandom::uniformInt(const std::uint32_t upperBound) {
+
+    auto next32 = [this] { return static_cast<std::uint32_t>((*this)() >> 32U); };
+
+    if (upperBound == std::numeric_limits<std::uint32_t>::max()) {
+        return next32();
+    }
+
+    const std::uint32_t range = upperBound + 1;
+    std::uint64_t product = static_cast<std::uint64_t>(next32()) * range;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        const std::uint32_t threshold = (0U - range) % range;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(next32()) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+
+    return static_cast<std::uint32_t>(product >> 32U);
+}
+
+// Fisher-Yates shuffle
+void FastRandom::shuffleVector(std::vector<int>& vec) {
+
+    for (std::size_t i = vec.size(); i > 1; --i) {
+        const std::uint32_t j = this->uniformInt(static_cast<std::uint32_t>(i - 1));
+        std::swap(vec[i - 1], vec[j]);
+    }
+}
+
+void FastRandom::chooseIndices(std::vector<int>& chosenIndices, const int numOfChosen, const int numOfIndices,
+                               const std::vector<int>& excludedIndices) {
+
+    sampleIndices(
+        [this](const int upperBound) {
+            assert(upperBound >= 0);
+            return static_cast<int>(this->uniformInt(static_cast<std::uint32_t>(upperBound)));
+        },
+        chosenIndices, numOfChosen, numOfIndices, excludedIndices);
+}
+
+} // namespace minesweeper
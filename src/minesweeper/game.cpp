@@ -1,18 +1,28 @@
-#include <algorithm> // std::max, std::remove
+#include <algorithm> // std::any_of, std::copy, std::fill, std::max, std::min, std::sort
 #include <cassert>   // assert
-#include <iomanip>   // std::setw
-#include <iostream>  // std::istream, std::ostream, std::endl
-#include <memory>    // std::unique_ptr, std::make_unique (C++14)
-#include <numeric>   // std::iota
+#include <chrono>    // std::chrono
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int8_t, std::uint64_t
+#include <iostream>  // std::istream, std::ostream, std::endl, std::ws
+#include <memory>    // std::make_unique
 #include <stdexcept> // std::out_of_range, std::invalid_argument
-#include <string>    // std::string, std::to_string
+#include <string>    // std::string, std::char_traits, std::to_string
 #include <utility>   // std::pair, std::move
 #include <vector>    // std::vector
 
 #include <json.hpp> // nlohmann::json
 
+#include <minesweeper/action_log.h>
+#include <minesweeper/bitboard.h>
 #include <minesweeper/cell.h>
+#include <minesweeper/fast_random.h>
 #include <minesweeper/game.h>
+#include <minesweeper/game_json_loader.h>
+#include <minesweeper/json_stream_writer.h>
+#include <minesweeper/latency_recorder.h>
+#include <minesweeper/memory_stream_buffer.h>
+#include <minesweeper/move_journal.h>
+#include <minesweeper/serialisation_format.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
 namespace minesweeper {
@@ -25,6 +35,12 @@ IRandom* Game::defaultRandom = nullptr;
 
 const int Game::MAX_NUMBER_OF_CELLS_AROUND_MINE = 8;
 
+constexpr int Game::VISUALISATION_CHUNK_SIZE;
+
+const int Game::NUM_OF_CELLS_PER_MINE_TO_COUNT_ALL_NUMS = 12;
+
+const int Game::MIN_CELL_TILE_SHIFT = 14;
+
 // serialisation magic/version keys:
 const char* Game::MAGIC_KEY = "magic";
 const char* Game::VERSION_KEY = "version";
@@ -45,6 +61,59 @@ const char* Game::NUM_OF_VISIBLE_CELLS_KEY = "numOfVisibleCells";
 const char* Game::CHECKED_MINE_KEY = "_checkedMine";
 const char* Game::MINES_HAVE_BEEN_SET_KEY = "minesHaveBeenSet";
 
+namespace {
+
+// whether checking the cell also checks all cells around it
+bool opensAround(const Cell& cell) { return !cell.hasMine() && cell.numOfMinesAround() == 0; }
+
+// points 'cellChanges' to 'changes' for the lifetime of this object (ie. during a single move)
+class CellChangeRecording {
+  public:
+    CellChangeRecording(std::vector<CellChange>*& cellChanges, std::vector<CellChange>& changes)
+        : _cellChanges(cellChanges) {
+        changes.clear();
+        this->_cellChanges = &changes;
+    }
+    CellChangeRecording(const CellChangeRecording& other) = delete;
+    CellChangeRecording& operator=(const CellChangeRecording& other) = delete;
+    ~CellChangeRecording() { this->_cellChanges = nullptr; }
+
+  private:
+    std::vector<CellChange>*& _cellChanges;
+};
+
+// records latency of an operation into 'latencyRecorder' at the end of the lifetime of this object
+// (nothing is timed, if 'latencyRecorder' is null)
+class LatencyTimer {
+  public:
+    LatencyTimer(LatencyRecorder* const latencyRecorder, const LatencyOperation operation, const int gridHeight,
+                 const int gridWidth)
+        : _latencyRecorder(latencyRecorder), _operation(operation) {
+        if (this->_latencyRecorder != nullptr) {
+            this->_boardSizeClass = LatencyRecorder::boardSizeClass(gridHeight, gridWidth);
+            this->_start = std::chrono::steady_clock::now();
+        }
+    }
+    LatencyTimer(const LatencyTimer& other) = delete;
+    LatencyTimer& operator=(const LatencyTimer& other) = delete;
+    ~LatencyTimer() {
+        if (this->_latencyRecorder != nullptr) {
+            const auto latency = std::chrono::steady_clock::now() - this->_start;
+            this->_latencyRecorder->record(
+                this->_operation, this->_boardSizeClass,
+                static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()));
+        }
+    }
+
+  private:
+    LatencyRecorder* _latencyRecorder;
+    LatencyOperation _operation;
+    BoardSizeClass _boardSizeClass = BoardSizeClass::CLASSIC;
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace
+
 // +----------+
 // | methods: |
 // +----------+
@@ -55,31 +124,51 @@ Game::Game(const Game& other)
     : _gridHeight(other._gridHeight), _gridWidth(other._gridWidth), _numOfMines(other._numOfMines),
       _numOfMarkedMines(other._numOfMarkedMines), _numOfWronglyMarkedCells(other._numOfWronglyMarkedCells),
       _numOfVisibleCells(other._numOfVisibleCells), _checkedMine(other._checkedMine),
-      _minesHaveBeenSet(other._minesHaveBeenSet), _cells{initCells_(other)}, _random(other._random) {}
+      _minesHaveBeenSet(other._minesHaveBeenSet), _stride(other._stride), _tileSize(other._tileSize),
+      _cellTiles(other._cellTiles), _tileReciprocal(other._tileReciprocal),
+      _tileReciprocalShift(other._tileReciprocalShift), _random(other._random), _revealEngine(other._revealEngine),
+      _hasGenerationSeed(other._hasGenerationSeed), _generationSeed(other._generationSeed),
+      _layoutSeed(other._layoutSeed), _firstCheckedX(other._firstCheckedX), _firstCheckedY(other._firstCheckedY),
+      _changedRows(other._changedRows), _gridChanged(other._gridChanged),
+      _moveJournal(other._moveJournal != nullptr ? std::make_unique<MoveJournal>(*other._moveJournal) : nullptr) {
+
+#ifdef MINESWEEPER_STATS
+    this->_stats = other._stats;
+    this->_numOfBytesSerialised.store(other._numOfBytesSerialised.load(std::memory_order_relaxed),
+                                      std::memory_order_relaxed);
+#endif
+}
 
 Game::Game(Game&& other) noexcept : Game() { swap(*this, other); }
 
-Game::Game(int gridSize, int numOfMines, IRandom* random) : Game(gridSize, gridSize, numOfMines, random) {}
+Game::Game(int gridSize, int numOfMines, IRandom* random, RevealEngine revealEngine)
+    : Game(gridSize, gridSize, numOfMines, random, revealEngine) {}
 
-Game::Game(int gridHeight, int gridWidth, int numOfMines, IRandom* random)
+Game::Game(int gridHeight, int gridWidth, int numOfMines, IRandom* random, RevealEngine revealEngine)
     : _gridHeight{verifyGridDimension_(gridHeight)},                     // throws
       _gridWidth{verifyGridDimension_(gridWidth)},                       // throws
       _numOfMines{verifyNumOfMines_(numOfMines, gridHeight, gridWidth)}, // throws
-      _cells{initCells_(this->_gridHeight, this->_gridWidth)}, _random{random} {}
+      _random{random}, _revealEngine{revealEngine} {
+
+    this->resizeCells_(this->_gridHeight, this->_gridWidth);
+}
 
-Game::Game(int gridSize, double proportionOfMines, IRandom* random)
-    : Game(gridSize, gridSize, proportionOfMines, random) {}
+Game::Game(int gridSize, double proportionOfMines, IRandom* random, RevealEngine revealEngine)
+    : Game(gridSize, gridSize, proportionOfMines, random, revealEngine) {}
 
-Game::Game(int gridHeight, int gridWidth, double proportionOfMines, IRandom* random)
+Game::Game(int gridHeight, int gridWidth, double proportionOfMines, IRandom* random, RevealEngine revealEngine)
     : _gridHeight{verifyGridDimension_(gridHeight)}, // throws
       _gridWidth{verifyGridDimension_(gridWidth)},
       _numOfMines{verifyNumOfMines_(
           static_cast<int>(verifyProportionOfMines_(proportionOfMines, gridHeight, gridWidth) * gridHeight * gridWidth),
           gridHeight, gridWidth)}, // throws
-      _cells{initCells_(this->_gridHeight, this->_gridWidth)}, _random{random} {}
+      _random{random}, _revealEngine{revealEngine} {
+
+    this->resizeCells_(this->_gridHeight, this->_gridWidth);
+}
 
 // required by to solve "error C2027: use of undefined type"
-// in short, std::unique_ptr requires destructor to be defined here
+// in short, std::shared_ptr<Cell> requires destructor to be defined here, where 'Cell' is a complete type
 // Check more info on this:
 // https://stackoverflow.com/questions/40383395/use-of-undefined-type-with-unique-ptr-to-forward-declared-class-and-defaulted
 // https://stackoverflow.com/questions/6012157/is-stdunique-ptrt-required-to-know-the-full-definition-of-t
@@ -109,9 +198,36 @@ void swap(Game& first, Game& second) {
     swap(first._checkedMine, second._checkedMine);
     swap(first._minesHaveBeenSet, second._minesHaveBeenSet);
 
-    swap(first._cells, second._cells);
+    swap(first._stride, second._stride);
+    swap(first._tileSize, second._tileSize);
+    swap(first._cellTiles, second._cellTiles);
+    swap(first._tileReciprocal, second._tileReciprocal);
+    swap(first._tileReciprocalShift, second._tileReciprocalShift);
 
     swap(first._random, second._random);
+
+    swap(first._revealEngine, second._revealEngine);
+
+    swap(first._hasGenerationSeed, second._hasGenerationSeed);
+    swap(first._generationSeed, second._generationSeed);
+    swap(first._layoutSeed, second._layoutSeed);
+    swap(first._firstCheckedX, second._firstCheckedX);
+    swap(first._firstCheckedY, second._firstCheckedY);
+
+    swap(first._changedRows, second._changedRows);
+    swap(first._gridChanged, second._gridChanged);
+
+    swap(first._moveJournal, second._moveJournal);
+    swap(first._actionLog, second._actionLog);
+    swap(first._latencyRecorder, second._latencyRecorder);
+
+#ifdef MINESWEEPER_STATS
+    swap(first._stats, second._stats);
+    const std::uint64_t firstNumOfBytesSerialised = first._numOfBytesSerialised.load(std::memory_order_relaxed);
+    first._numOfBytesSerialised.store(second._numOfBytesSerialised.load(std::memory_order_relaxed),
+                                      std::memory_order_relaxed);
+    second._numOfBytesSerialised.store(firstNumOfBytesSerialised, std::memory_order_relaxed);
+#endif
 }
 
 // static method
@@ -223,61 +339,153 @@ int Game::verifyNumOfVisibleCells_(int numOfVisibleCells, int gridHeight, int gr
 }
 
 // static method
-// consider combining with Game::resizeCells()
-std::vector<std::vector<std::unique_ptr<Cell>>> Game::initCells_(const int gridHeight, const int gridWidth) {
+void Game::verifyVisualisationArea_(const int areaX, const int areaY, const int areaWidth, const int areaHeight,
+                                    const int gridHeight, const int gridWidth) {
 
-    assert(gridHeight >= 0 && gridWidth >= 0);
+    if (areaWidth < 0 || areaHeight < 0) {
+        throw std::out_of_range("Game::verifyVisualisationArea_(int areaX, int areaY, int areaWidth, int areaHeight, "
+                                "int gridHeight, int gridWidth): Trying to visualise an area with negative (" +
+                                std::to_string(areaWidth) + "x" + std::to_string(areaHeight) + ") dimensions.");
+    }
 
-    std::vector<std::vector<std::unique_ptr<Cell>>> outputCellMatrix;
-    outputCellMatrix.reserve(gridHeight);
-    for (int y = 0; y < gridHeight; ++y) {
-        std::vector<std::unique_ptr<Cell>> outputCellRow;
-        outputCellRow.reserve(gridWidth);
-        for (int x = 0; x < gridWidth; ++x) {
-            outputCellRow.emplace_back(std::make_unique<Cell>());
-        }
-        outputCellMatrix.emplace_back(std::move(outputCellRow));
+    if (areaX < 0 || areaY < 0 || areaWidth > gridWidth - areaX || areaHeight > gridHeight - areaY) {
+        throw std::out_of_range("Game::verifyVisualisationArea_(int areaX, int areaY, int areaWidth, int areaHeight, "
+                                "int gridHeight, int gridWidth): Trying to visualise an area (" +
+                                std::to_string(areaWidth) + "x" + std::to_string(areaHeight) + " from (" +
+                                std::to_string(areaX) + ", " + std::to_string(areaY) + ")) outside the grid.");
     }
-    return outputCellMatrix;
 }
 
-// static method
-// consider combining with Game::resizeCells()
-std::vector<std::vector<std::unique_ptr<Cell>>> Game::initCells_(const Game& other) {
+void Game::resizeCells_(const int gridHeight, const int gridWidth) {
 
-    auto gridHeight = other._gridHeight;
-    auto gridWidth = other._gridWidth;
+    assert(gridHeight >= 0 && gridWidth >= 0);
 
-    std::vector<std::vector<std::unique_ptr<Cell>>> outputCellMatrix;
-    outputCellMatrix.reserve(gridHeight);
-    for (const auto& otherCellRow : other._cells) {
-        std::vector<std::unique_ptr<Cell>> outputCellRow;
-        outputCellRow.reserve(gridWidth);
-        for (const auto& otherCellPtr : otherCellRow) {
-            outputCellRow.emplace_back(std::make_unique<Cell>(*otherCellPtr));
-        }
-        outputCellMatrix.emplace_back(std::move(outputCellRow));
+    // cell layout depends on grid width, hence all cells are reinitialised
+    this->_stride = gridWidth + 2;
+    const int paddedHeight = gridHeight + 2;
+    const int rowsPerTile = std::min(((1 << MIN_CELL_TILE_SHIFT) + this->_stride - 1) / this->_stride, paddedHeight);
+    this->_tileSize = rowsPerTile * this->_stride;
+    const int numOfTiles = (paddedHeight + rowsPerTile - 1) / rowsPerTile;
+
+    // reciprocal rounded up with 31 + ceil(log2(_tileSize)) bits of fraction
+    // (its error is smaller than 1 / _tileSize for every 31-bit index, hence flooring the product is exact)
+    int tileSizeBits = 0;
+    while ((1 << tileSizeBits) < this->_tileSize) {
+        ++tileSizeBits;
+    }
+    this->_tileReciprocalShift = 31 + tileSizeBits;
+    this->_tileReciprocal = ((std::uint64_t{1} << static_cast<unsigned>(this->_tileReciprocalShift)) +
+                             static_cast<std::uint64_t>(this->_tileSize) - 1) /
+                            static_cast<std::uint64_t>(this->_tileSize);
+
+    // rows of grid cells are surrounded by border cells
+    std::vector<Cell> borderRow(this->_stride);
+    for (Cell& cell : borderRow) {
+        cell.makeBorder();
+    }
+    std::vector<Cell> gridRow(borderRow);
+    std::fill(gridRow.begin() + 1, gridRow.begin() + 1 + gridWidth, Cell());
+
+    const std::shared_ptr<Cell> cells(new Cell[static_cast<std::size_t>(paddedHeight) * this->_stride],
+                                      std::default_delete<Cell[]>());
+    for (int row = 0; row < paddedHeight; ++row) {
+        const std::vector<Cell>& rowCells = row == 0 || row == paddedHeight - 1 ? borderRow : gridRow;
+        std::copy(rowCells.begin(), rowCells.end(), cells.get() + static_cast<std::size_t>(row) * this->_stride);
+    }
+
+    // tiles of new cells are parts of a single allocation, which is freed together with the last of them
+    // (each tile still has a reference count of its own, so that it is copied on write only when it is shared)
+    this->_cellTiles.clear();
+    this->_cellTiles.reserve(numOfTiles);
+    for (int tileIndex = 0; tileIndex < numOfTiles; ++tileIndex) {
+        this->_cellTiles.emplace_back(cells.get() + static_cast<std::size_t>(tileIndex) * this->_tileSize,
+                                      [cells](Cell* /*tile*/) {});
     }
-    return outputCellMatrix;
+
+    this->_gridChanged = true;
+    this->clearMoveJournal_();
 }
 
-// consider combining with Game::initCells_()
-void Game::resizeCells_(const int gridHeight, const int gridWidth) {
+int Game::cellIndex_(const int x, const int y) const {
 
-    assert(gridHeight >= 0 && gridWidth >= 0);
+    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
 
-    this->_cells.reserve(gridHeight);
-    this->_cells.resize(gridHeight);
-    for (auto& cellRow : _cells) {
+    return (y + 1) * this->_stride + (x + 1);
+}
 
-        cellRow.reserve(gridWidth);
-        if (cellRow.size() < gridWidth) {
-            for (size_t i = cellRow.size(); i < gridWidth; ++i) {
-                cellRow.emplace_back(std::make_unique<Cell>());
-            }
-        }
-        cellRow.resize(gridWidth);
+int Game::gridStride_() const { return this->_stride; }
+
+int Game::tileIndex_(const int cellIndex) const {
+
+    assert(cellIndex >= 0);
+
+    return static_cast<int>((static_cast<std::uint64_t>(cellIndex) * this->_tileReciprocal) >>
+                            static_cast<unsigned>(this->_tileReciprocalShift));
+}
+
+const Cell& Game::cell_(const int cellIndex) const {
+    const int tileIndex = this->tileIndex_(cellIndex);
+    return this->_cellTiles[tileIndex].get()[cellIndex - tileIndex * this->_tileSize];
+}
+
+const Cell& Game::cellAt_(const int x, const int y) const { return this->cell_(this->cellIndex_(x, y)); }
+
+const Cell* Game::cellRow_(const int y) const {
+
+    assert(y >= 0 && y < this->_gridHeight);
+
+    return &this->cell_((y + 1) * this->_stride + 1);
+}
+
+Cell& Game::mutableCell_(const int cellIndex) {
+
+    const int tileIndex = this->tileIndex_(cellIndex);
+    const std::shared_ptr<Cell>& tile = this->_cellTiles[tileIndex];
+    Cell* const tileCells = tile.use_count() == 1 ? tile.get() : this->mutableTile_(tileIndex);
+
+    return tileCells[cellIndex - tileIndex * this->_tileSize];
+}
+
+Cell& Game::mutableCellAt_(const int x, const int y) { return this->mutableCell_(this->cellIndex_(x, y)); }
+
+Cell* Game::mutableCellRow_(const int y) {
+
+    assert(y >= 0 && y < this->_gridHeight);
+
+    return &this->mutableCell_((y + 1) * this->_stride + 1);
+}
+
+Cell* Game::mutableTile_(const int tileIndex) {
+
+    std::shared_ptr<Cell>& tile = this->_cellTiles[tileIndex];
+
+    // tile shared with a copy of this game is copied before it is changed
+    if (tile.use_count() != 1) {
+        const int paddedHeight = this->_gridHeight + 2;
+        const int numOfCells = std::min(this->_tileSize, paddedHeight * this->_stride - tileIndex * this->_tileSize);
+        std::shared_ptr<Cell> tileCopy(new Cell[numOfCells], std::default_delete<Cell[]>());
+        std::copy(tile.get(), tile.get() + numOfCells, tileCopy.get());
+        tile = std::move(tileCopy);
     }
+
+    return tile.get();
+}
+
+template <class NeighbourFunction>
+void Game::forEachNeighbour_(const int cellIndex, NeighbourFunction neighbourFunction) const {
+
+    this->countStat_(&GameStats::numOfNeighbourLookups, 8);
+
+    const int stride = this->gridStride_();
+
+    neighbourFunction(cellIndex - stride - 1); // top left
+    neighbourFunction(cellIndex - stride);     // top
+    neighbourFunction(cellIndex - stride + 1); // top right
+    neighbourFunction(cellIndex - 1);          // left
+    neighbourFunction(cellIndex + 1);          // right
+    neighbourFunction(cellIndex + stride - 1); // bottom left
+    neighbourFunction(cellIndex + stride);     // bottom
+    neighbourFunction(cellIndex + stride + 1); // bottom right
 }
 
 void Game::createMinesAndNums(const int initChosenX, const int initChosenY) {
@@ -292,81 +500,188 @@ void Game::createMinesAndNums(const int initChosenX, const int initChosenY) {
                                     "Trying to create mines and numbers for a grid that already has them created.");
     }
 
+    this->recordAction_(Action{ActionType::CREATE_MINES, initChosenX, initChosenY, false, 0, 0, 0});
+
     this->createMinesAndNums_(initChosenX, initChosenY);
 }
 
 void Game::createMinesAndNums_(const int initChosenX, const int initChosenY) {
 
+    if (this->_hasGenerationSeed) {
+        // (same mine layout for the same seed on every platform)
+        FastRandom seededRandom(this->_generationSeed);
+        this->createMinesAndNums_(initChosenX, initChosenY, seededRandom);
+
+        this->_layoutSeed = this->_generationSeed;
+        this->_firstCheckedX = initChosenX;
+        this->_firstCheckedY = initChosenY;
+    } else {
+        this->createMinesAndNums_(initChosenX, initChosenY, this->random_());
+    }
+}
+
+void Game::createMinesAndNums_(const int initChosenX, const int initChosenY, IRandom& random) {
+
     assert(initChosenX >= 0 && initChosenY >= 0 && initChosenX < this->_gridWidth && initChosenY < this->_gridHeight);
 
     assert(!this->_minesHaveBeenSet);
 
-    std::vector<int> mineSpots(this->_gridWidth * this->_gridHeight);
-    this->chooseRandomMineCells_(mineSpots, initChosenX, initChosenY);
+    const LatencyTimer latencyTimer(this->_latencyRecorder, LatencyOperation::MINE_GENERATION, this->_gridHeight,
+                                    this->_gridWidth);
+
+#ifdef MINESWEEPER_STATS
+    const auto generationStart = std::chrono::steady_clock::now();
+#endif
+
+    this->_gridChanged = true;
+
+    std::vector<int> mineSpots;
+    this->chooseRandomMineCells_(random, mineSpots, initChosenX, initChosenY);
+
+    // numbers around sparse mines are incremented mine by mine,
+    // otherwise it is faster to count them for all cells at once
+    const bool countNumsForAllCells = this->_numOfMines * NUM_OF_CELLS_PER_MINE_TO_COUNT_ALL_NUMS >=
+                                      this->_gridHeight * this->_gridWidth;
 
-    int x = 0;
-    int y = 0;
     for (int i = 0; i < this->_numOfMines; ++i) {
 
-        x = mineSpots[i] % this->_gridWidth;
-        y = mineSpots[i] / this->_gridWidth;
+        const int cellIndex = this->cellIndex_(mineSpots[i] % this->_gridWidth, mineSpots[i] / this->_gridWidth);
 
-        this->createMine_(x, y);
+        this->createMine_(cellIndex);
+
+        if (!countNumsForAllCells) {
+            this->incrNumsAroundMine_(cellIndex);
+        }
+    }
 
-        this->incrNumsAroundMine_(x, y);
+    if (countNumsForAllCells) {
+        this->createNumsAroundMines_(mineSpots);
     }
 
     this->_minesHaveBeenSet = true;
+
+#ifdef MINESWEEPER_STATS
+    this->_stats.numOfMineGenerations += 1;
+    this->_stats.mineGenerationNanoseconds += static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - generationStart)
+            .count());
+#endif
 }
 
-void Game::chooseRandomMineCells_(std::vector<int>& mineSpots, const int initChosenX, const int initChosenY) const {
+void Game::chooseRandomMineCells_(IRandom& random, std::vector<int>& mineSpots, const int initChosenX,
+                                  const int initChosenY) const {
 
-    // to populate mineSpots vector with values: 0, 1, 2, ..., gridWidth*gridHeight - 1
-    std::iota(mineSpots.begin(), mineSpots.end(), 0);
+    // bad gridspots (those on and around chosen initial spot) in ascending order
+    std::vector<int> excludedSpots;
+    excludedSpots.reserve(MAX_NUMBER_OF_CELLS_AROUND_MINE + 1);
+    excludedSpots.push_back(initChosenY * this->_gridWidth + initChosenX);
 
-    // to shuffle this vector
-    this->randomizeMineVector_(mineSpots);
+    const int stride = this->gridStride_();
+    this->forEachNeighbour_(this->cellIndex_(initChosenX, initChosenY), [&](const int neighbourIndex) {
+        if (!this->cell_(neighbourIndex).isBorder()) {
+            const int neighbourX = neighbourIndex % stride - 1;
+            const int neighbourY = neighbourIndex / stride - 1;
+            excludedSpots.push_back(neighbourY * this->_gridWidth + neighbourX);
+        }
+    });
+    std::sort(excludedSpots.begin(), excludedSpots.end());
 
-    // to remove bad gridspots (those on and around chosen initial spot)
-    mineSpots.erase(std::remove(mineSpots.begin(), mineSpots.end(), (initChosenY * this->_gridWidth + initChosenX)),
-                    mineSpots.end());
-    for (auto const& neighbourCell : this->neighbourCells_(initChosenX, initChosenY)) {
-        mineSpots.erase(std::remove(mineSpots.begin(), mineSpots.end(),
-                                    neighbourCell.second * this->_gridWidth + neighbourCell.first),
-                        mineSpots.end());
-    }
+    // to choose mine spots among the rest of the gridspots
+    random.chooseIndices(mineSpots, this->_numOfMines, this->_gridWidth * this->_gridHeight, excludedSpots);
 }
 
-void Game::randomizeMineVector_(std::vector<int>& mineSpots) const {
+IRandom& Game::random_() const {
 
     if (this->_random != nullptr) {
-        this->_random->shuffleVector(mineSpots);
-    } else {
-        if (Game::defaultRandom != nullptr) {
-            Game::defaultRandom->shuffleVector(mineSpots);
-        } else {
-            throw std::invalid_argument("Game::randomizeMineVector_(std::vector<int>& mineSpots): "
-                                        "Neither field '_random' nor static field 'defaultRandom' is initialised.");
+        return *this->_random;
+    }
+
+    if (Game::defaultRandom == nullptr) {
+        throw std::invalid_argument("Game::random_(): "
+                                    "Neither field '_random' nor static field 'defaultRandom' is initialised.");
+    }
+
+    return *Game::defaultRandom;
+}
+
+void Game::createMine_(const int cellIndex) {
+
+    assert(!this->cell_(cellIndex).isBorder());
+    this->mutableCell_(cellIndex).putMine();
+}
+
+void Game::incrNumsAroundMine_(const int cellIndex) {
+
+    assert(!this->cell_(cellIndex).isBorder());
+
+    // border cells are also incremented, but their numbers are never used
+    // (neighbours on each row are next to each other, hence they are changed through a row pointer)
+    this->countStat_(&GameStats::numOfNeighbourLookups, 8);
+    const int stride = this->gridStride_();
+    for (const int rowOffset : {-stride, 0, stride}) {
+        Cell* const cells = &this->mutableCell_(cellIndex + rowOffset - 1);
+        cells[0].incrNumOfMinesAround();
+        if (rowOffset != 0) {
+            cells[1].incrNumOfMinesAround();
         }
+        cells[2].incrNumOfMinesAround();
     }
 }
 
-void Game::createMine_(const int x, const int y) {
+// counts mines around every cell at once:
+// mines are put on a bit plane, which is summed 3x3 around each cell with bit-sliced adders 64 cells at a time
+void Game::createNumsAroundMines_(const std::vector<int>& mineSpots) {
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    this->_cells[y][x]->putMine();
+    using bitboard::Word;
+
+    const int height = this->_gridHeight;
+    const int width = this->_gridWidth;
+    const int numOfWords = bitboard::numOfWords(width);
+
+    std::vector<Word> mineBits(static_cast<std::size_t>(height) * numOfWords, 0);
+    for (int i = 0; i < this->_numOfMines; ++i) {
+        const int x = mineSpots[i] % width;
+        const int y = mineSpots[i] / width;
+        mineBits[static_cast<std::size_t>(y) * numOfWords + x / bitboard::WORD_BITS] |=
+            Word{1} << static_cast<unsigned>(x % bitboard::WORD_BITS);
+    }
+
+    this->createNumsFromMineBits_(mineBits);
 }
 
-void Game::incrNumsAroundMine_(const int x, const int y) {
+void Game::createNumsFromMineBits_(const std::vector<std::uint64_t>& mineBits) {
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
+    using bitboard::Word;
 
-    for (auto const& neighbourCell : this->neighbourCells_(x, y)) {
-        this->_cells[neighbourCell.second][neighbourCell.first]->incrNumOfMinesAround();
+    const int height = this->_gridHeight;
+    const int width = this->_gridWidth;
+    const int numOfWords = bitboard::numOfWords(width);
+
+    for (int y = 0; y < height; ++y) {
+        const Word* const middle = &mineBits[static_cast<std::size_t>(y) * numOfWords];
+        const Word* const above = y > 0 ? middle - numOfWords : nullptr;
+        const Word* const below = y < height - 1 ? middle + numOfWords : nullptr;
+        Cell* const cellRow = this->mutableCellRow_(y);
+
+        for (int i = 0; i < numOfWords; ++i) {
+            Word count[4];
+            bitboard::countNeighbours(above, middle, below, i, numOfWords, count);
+
+            // (words without mines around are skipped, since numbers are still zero)
+            if ((count[0] | count[1] | count[2] | count[3]) != 0) {
+                const int firstX = i * bitboard::WORD_BITS;
+                Cell::setNumsOfMinesAround(&cellRow[firstX], count, std::min(bitboard::WORD_BITS, width - firstX));
+            }
+        }
     }
 }
 
-void Game::reset(bool keepCreatedMines) { this->reset_(keepCreatedMines); }
+void Game::reset(bool keepCreatedMines) {
+
+    this->recordAction_(Action{ActionType::RESET, 0, 0, keepCreatedMines, 0, 0, 0});
+
+    this->reset_(keepCreatedMines);
+}
 
 void Game::reset_(bool keepCreatedMines) {
 
@@ -378,14 +693,22 @@ void Game::reset_(bool keepCreatedMines) {
 
     if (!keepCreatedMines) {
         this->_minesHaveBeenSet = false;
-    }
+        this->_firstCheckedX = -1;
+        this->_firstCheckedY = -1;
 
-    // reset cells
-    for (auto& cellRow : this->_cells) {
-        for (auto& cell : cellRow) {
+        // reset cells (reinitialising also clears mine numbers from border cells)
+        this->resizeCells_(this->_gridHeight, this->_gridWidth);
+    } else {
 
-            cell->reset(keepCreatedMines);
+        // reset cells (border cells are left as they are)
+        for (int y = 0; y < this->_gridHeight; ++y) {
+            Cell* const cellRow = this->mutableCellRow_(y);
+            for (int x = 0; x < this->_gridWidth; ++x) {
+                cellRow[x].reset(keepCreatedMines);
+            }
         }
+        this->_gridChanged = true;
+        this->clearMoveJournal_();
     }
 }
 
@@ -398,11 +721,13 @@ void Game::newGame(int gridHeight, int gridWidth, int numOfMines) {
     verifyGridDimension_(gridWidth);
     verifyNumOfMines_(numOfMines, gridHeight, gridWidth);
 
-    this->reset_(false);
-    this->resizeCells_(gridHeight, gridWidth);
+    this->recordAction_(Action{ActionType::NEW_GAME, 0, 0, false, gridHeight, gridWidth, numOfMines});
+
+    // (cells are reinitialised by the reset, once for the new dimensions)
     this->_gridHeight = gridHeight;
     this->_gridWidth = gridWidth;
     this->_numOfMines = numOfMines;
+    this->reset_(false);
 }
 
 void Game::newGame(int gridSize, double proportionOfMines) { this->newGame(gridSize, gridSize, proportionOfMines); }
@@ -416,14 +741,23 @@ void Game::newGame(int gridHeight, int gridWidth, double proportionOfMines) {
     int newNumOfMines = static_cast<int>(proportionOfMines * gridHeight * gridWidth);
     verifyNumOfMines_(newNumOfMines, gridHeight, gridWidth);
 
-    this->reset_(false);
-    this->resizeCells_(gridHeight, gridWidth);
+    // (recorded with the number of mines, so that replays do not depend on floating point rounding)
+    this->recordAction_(Action{ActionType::NEW_GAME, 0, 0, false, gridHeight, gridWidth, newNumOfMines});
+
+    // (cells are reinitialised by the reset, once for the new dimensions)
     this->_gridHeight = gridHeight;
     this->_gridWidth = gridWidth;
     this->_numOfMines = newNumOfMines;
+    this->reset_(false);
 }
 
 // to mark (or unmark) given coordinates, and keeping track of marked and wrongly marked mines
+void Game::markInputCoordinates(const int x, const int y, std::vector<CellChange>& changes) {
+
+    const CellChangeRecording recording(this->_cellChanges, changes);
+    this->markInputCoordinates(x, y);
+}
+
 void Game::markInputCoordinates(const int x, const int y) {
 
     if (x < 0 || y < 0 || x >= this->_gridWidth || y >= this->_gridHeight) {
@@ -439,6 +773,10 @@ void Game::markInputCoordinates(const int x, const int y) {
                                     "checkInputCoordinates(const int x, const int y).)");
     }
 
+    this->recordAction_(Action{ActionType::MARK, x, y, false, 0, 0, 0});
+
+    this->beginMove_();
+
     // if cell is already visible, do nothing
     // else mark or unmark it and update 'marked counters'
     if (!this->isCellVisible_(x, y)) {
@@ -463,6 +801,8 @@ void Game::markInputCoordinates(const int x, const int y) {
             }
         }
     }
+
+    this->endMove_();
 }
 
 bool Game::allMinesMarked_() const { return this->_numOfMines == this->_numOfMarkedMines; }
@@ -505,7 +845,7 @@ bool Game::isCellVisible_(const int x, const int y) const {
 
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
 
-    return this->_cells[y][x]->isVisible();
+    return this->cellAt_(x, y).isVisible();
 }
 
 bool Game::doesCellHaveMine(const int x, const int y) const {
@@ -521,7 +861,7 @@ bool Game::doesCellHaveMine_(const int x, const int y) const {
 
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
 
-    return this->_cells[y][x]->hasMine();
+    return this->cellAt_(x, y).hasMine();
 }
 
 bool Game::isCellMarked(const int x, const int y) const {
@@ -537,7 +877,7 @@ bool Game::isCellMarked_(const int x, const int y) const {
 
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
 
-    return this->_cells[y][x]->isMarked();
+    return this->cellAt_(x, y).isMarked();
 }
 
 int Game::numOfMinesAroundCell(const int x, const int y) const {
@@ -553,40 +893,107 @@ int Game::numOfMinesAroundCell_(const int x, const int y) const {
 
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
 
-    return this->_cells[y][x]->numOfMinesAround();
-}
-
-void Game::makeCellVisible_(const int x, const int y) {
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    this->_cells[y][x]->makeVisible();
+    return this->cellAt_(x, y).numOfMinesAround();
 }
 
 void Game::markCell_(const int x, const int y) {
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    this->_cells[y][x]->markCell();
+    const int cellIndex = this->cellIndex_(x, y);
+    this->mutableCell_(cellIndex).markCell();
+    this->markRowChanged_(cellIndex);
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->addCellChange(cellIndex, MoveJournal::CellChangeType::MARK);
+    }
+    this->addCellChange_(cellIndex);
 }
 
 void Game::unmarkCell_(const int x, const int y) {
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    this->_cells[y][x]->unmarkCell();
+    const int cellIndex = this->cellIndex_(x, y);
+    this->mutableCell_(cellIndex).unmarkCell();
+    this->markRowChanged_(cellIndex);
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->addCellChange(cellIndex, MoveJournal::CellChangeType::UNMARK);
+    }
+    this->addCellChange_(cellIndex);
+}
+
+void Game::markRowChanged_(const int cellIndex) {
+
+    // (rows are not tracked, while the whole grid has changed anyway)
+    if (!this->_gridChanged) {
+        const auto y = static_cast<unsigned>(cellIndex / this->gridStride_() - 1);
+        this->_changedRows[y / bitboard::WORD_BITS] |= bitboard::Word{1} << (y % bitboard::WORD_BITS);
+    }
+}
+
+void Game::addCellChange_(const int cellIndex) {
+
+    if (this->_cellChanges != nullptr) {
+        const int stride = this->gridStride_();
+        this->_cellChanges->push_back(
+            CellChange{cellIndex % stride - 1, cellIndex / stride - 1, this->cell_(cellIndex).visualise()});
+    }
 }
 
 VisualMinesweeperCell Game::visualiseCell_(const int x, const int y) const {
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    return this->_cells[y][x]->visualise();
+    return this->cellAt_(x, y).visualise();
 }
 
 VisualMinesweeperCell Game::visualiseCellSolution_(const int x, const int y) const {
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    return this->_cells[y][x]->visualiseSolution();
+    return this->cellAt_(x, y).visualiseSolution();
 }
 
 VisualMinesweeperCell Game::visualiseCellSolutionData_(const int x, const int y) const {
     assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    return this->_cells[y][x]->visualiseSolutionData();
+    return this->cellAt_(x, y).visualiseSolutionData();
 }
 
+template <class T>
+void Game::visualiseCells_(const VisualisationType visualisationType, int firstCell, int numOfCells,
+                           T* output) const {
+
+    assert(firstCell >= 0 && numOfCells >= 0 && firstCell + numOfCells <= this->_gridHeight * this->_gridWidth);
+
+    // rows are separated by border cells, hence cells are visualised row by row
+    while (numOfCells > 0) {
+        const int x = firstCell % this->_gridWidth;
+        const int y = firstCell / this->_gridWidth;
+        const int numOfRowCells = std::min(this->_gridWidth - x, numOfCells);
+        const Cell* const cells = &this->cellAt_(x, y);
+
+        switch (visualisationType) {
+        case VisualisationType::CELL:
+            Cell::visualise(cells, numOfRowCells, output);
+            break;
+        case VisualisationType::CELL_SOLUTION:
+            Cell::visualiseSolution(cells, numOfRowCells, output);
+            break;
+        case VisualisationType::CELL_SOLUTION_DATA:
+            Cell::visualiseSolutionData(cells, numOfRowCells, output);
+            break;
+        }
+
+        firstCell += numOfRowCells;
+        numOfCells -= numOfRowCells;
+        output += numOfRowCells;
+    }
+}
+
+template void Game::visualiseCells_(VisualisationType visualisationType, int firstCell, int numOfCells,
+                                    VisualMinesweeperCell* output) const;
+template void Game::visualiseCells_(VisualisationType visualisationType, int firstCell, int numOfCells,
+                                    std::int8_t* output) const;
+
 // to check user given coordinates, and make it visible
+void Game::checkInputCoordinates(const int x, const int y, std::vector<CellChange>& changes) {
+
+    const CellChangeRecording recording(this->_cellChanges, changes);
+    this->checkInputCoordinates(x, y);
+}
+
 void Game::checkInputCoordinates(const int x, const int y) {
 
     if (x < 0 || y < 0 || x >= this->_gridWidth || y >= this->_gridHeight) {
@@ -594,49 +1001,269 @@ void Game::checkInputCoordinates(const int x, const int y) {
             "Game::checkInputCoordinates(const int x, const int y): Trying to check cell outside grid.");
     }
 
-    this->_cellCoordsToCheck.emplace(x, y);
-    this->handleCellCoordsToCheckQueue_();
+    this->recordAction_(Action{ActionType::CHECK, x, y, false, 0, 0, 0});
+
+    const LatencyTimer latencyTimer(this->_latencyRecorder, LatencyOperation::CHECK, this->_gridHeight,
+                                    this->_gridWidth);
+
+    this->beginMove_();
+
+    if (!this->_minesHaveBeenSet) {
+        this->createMinesAndNums_(x, y);
+    }
+
+    this->checkCell_(this->cellIndex_(x, y));
+
+    this->endMove_();
 }
 
-void Game::handleCellCoordsToCheckQueue_() {
+void Game::checkCell_(const int cellIndex) {
 
-    while (!this->_cellCoordsToCheck.empty()) {
-        auto coordsToCheck = this->_cellCoordsToCheck.front();
-        this->_cellCoordsToCheck.pop();
-        this->checkInputCoordinates_(coordsToCheck.first, coordsToCheck.second);
+    const Cell& cell = this->cell_(cellIndex);
+
+    // border cells are always visible, hence never checked
+    if (!cell.isVisible() && !cell.isMarked()) {
+        if (opensAround(cell)) {
+            if (this->_revealEngine == RevealEngine::BITBOARD) {
+                this->revealOpeningBitboard_(cellIndex);
+            } else {
+                this->revealOpening_(cellIndex);
+            }
+        } else {
+            this->revealCell_(cellIndex);
+        }
     }
 }
 
-void Game::checkInputCoordinates_(const int x, const int y) {
+void Game::revealCell_(const int cellIndex) { this->revealCell_(this->mutableCell_(cellIndex), cellIndex); }
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
+void Game::revealCell_(Cell& cell, const int cellIndex) {
 
-    // could maybe be moved to public 'Game::checkInputCoordinates(const int X, const int Y)'
-    if (!_minesHaveBeenSet) {
-        this->createMinesAndNums_(x, y);
+    cell.makeVisible();
+    ++(this->_numOfVisibleCells);
+    this->countStat_(&GameStats::numOfCellsRevealed);
+
+    if (cell.hasMine()) {
+        this->_checkedMine = true;
     }
 
-    if (!(this->isCellVisible_(x, y)) && !(this->isCellMarked_(x, y))) {
-        this->makeCellVisible_(x, y);
-        ++(this->_numOfVisibleCells);
+    this->markRowChanged_(cellIndex);
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->addCellChange(cellIndex, MoveJournal::CellChangeType::REVEAL);
+    }
+    this->addCellChange_(cellIndex);
+}
+
+// scanline flood fill:
+// reveals whole row spans of opening cells at a time, and only seeds spans on the rows above and below,
+// so that every cell is looked at a bounded number of times
+void Game::revealOpening_(const int cellIndex) {
 
-        if (this->doesCellHaveMine_(x, y)) {
-            this->_checkedMine = true;
-        } else if (this->numOfMinesAroundCell_(x, y) == 0) {
-            this->checkAroundCoordinate_(x, y);
+    this->_openingSpanSeeds.push_back(cellIndex);
+    this->countStat_(&GameStats::numOfOpeningSeedsPushed);
+
+    while (!this->_openingSpanSeeds.empty()) {
+        const int seedIndex = this->_openingSpanSeeds.back();
+        this->_openingSpanSeeds.pop_back();
+        this->countStat_(&GameStats::numOfOpeningSeedsPopped);
+
+        // seed might have been revealed as part of another span after it was pushed
+        if (!this->cell_(seedIndex).isVisible()) {
+            this->revealOpeningSpan_(seedIndex);
+        } else {
+            this->countStat_(&GameStats::numOfDuplicateOpeningSeeds);
         }
     }
+
+    // stack is empty, but keeps its capacity for the next check
 }
 
-void Game::checkAroundCoordinate_(const int x, const int y) {
+void Game::revealOpeningSpan_(const int seedIndex) {
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
+    const int stride = this->gridStride_();
 
-    for (auto&& neighbourCell : this->neighbourCells_(x, y)) {
-        this->_cellCoordsToCheck.push(neighbourCell);
+    // cells are accessed through pointers to the row of the seed, and the rows above and below it
+    // (changed rows are copied at most once, if they are shared with another game)
+    const int seedX = seedIndex % stride;
+    const int seedRowIndex = seedIndex - seedX;
+    Cell* const seedRow = &this->mutableCell_(seedRowIndex);
+
+    auto isHidden = [](const Cell& cell) { return !cell.isVisible() && !cell.isMarked(); };
+
+    // to find the span of hidden opening cells on the row of the seed
+    // (border cells are visible, hence spans never leave the grid)
+    int spanStart = seedX;
+    while (isHidden(seedRow[spanStart - 1]) && opensAround(seedRow[spanStart - 1])) {
+        --spanStart;
+    }
+    int spanEnd = seedX;
+    while (isHidden(seedRow[spanEnd + 1]) && opensAround(seedRow[spanEnd + 1])) {
+        ++spanEnd;
+    }
+
+    // to reveal the span and the cells bounding it on the same row
+    for (int x = spanStart - 1; x <= spanEnd + 1; ++x) {
+        if (isHidden(seedRow[x])) {
+            this->revealCell_(seedRow[x], seedRowIndex + x);
+        }
+    }
+
+    // to reveal cells next to the span on the rows above and below,
+    // except hidden opening cells, for which only the first of each run is pushed as a new seed
+    for (const int rowOffset : {-stride, stride}) {
+        const int rowIndex = seedRowIndex + rowOffset;
+        Cell* const row = &this->mutableCell_(rowIndex);
+        bool inOpeningRun = false;
+        for (int x = spanStart - 1; x <= spanEnd + 1; ++x) {
+            if (isHidden(row[x]) && opensAround(row[x])) {
+                if (!inOpeningRun) {
+                    this->_openingSpanSeeds.push_back(rowIndex + x);
+                    this->countStat_(&GameStats::numOfOpeningSeedsPushed);
+                }
+                inOpeningRun = true;
+            } else {
+                if (isHidden(row[x])) {
+                    this->revealCell_(row[x], rowIndex + x);
+                }
+                inOpeningRun = false;
+            }
+        }
     }
 }
 
+// word-parallel flood fill:
+// grows the opening one row of 64-bit words at a time until nothing changes,
+// and then reveals the opening dilated by one cell (its bounding numbers) in one pass
+void Game::revealOpeningBitboard_(const int cellIndex) {
+
+    using bitboard::Word;
+
+    const int height = this->_gridHeight;
+    const int width = this->_gridWidth;
+    const int stride = this->gridStride_();
+    const int numOfWords = bitboard::numOfWords(width);
+    const std::size_t planeSize = static_cast<std::size_t>(height) * numOfWords;
+
+    // planes: hidden cells, hidden cells which open around, cells of the opening, and two scratch rows
+    // (allocated for the whole grid, but only rows the flood fill reaches are filled, see 'fillRows' below,
+    // and the rest keep whatever an earlier check left in them)
+    const std::size_t planesSize = 3 * planeSize + 2 * static_cast<std::size_t>(numOfWords);
+    if (this->_openingBitPlanes.size() < planesSize) {
+        this->_openingBitPlanes.resize(planesSize);
+    }
+    Word* const hiddenBits = this->_openingBitPlanes.data();
+    Word* const opensAroundBits = hiddenBits + planeSize;
+    Word* const openingBits = opensAroundBits + planeSize;
+    Word* const scratchRow = openingBits + planeSize;
+    Word* const seedRow = scratchRow + numOfWords;
+
+    auto rowOf = [numOfWords](Word* const plane, const int y) {
+        return plane + static_cast<std::size_t>(y) * numOfWords;
+    };
+
+    // to start from the checked cell
+    const int checkedX = cellIndex % stride - 1;
+    const int checkedY = cellIndex / stride - 1;
+    int topRow = checkedY;
+    int bottomRow = checkedY;
+
+    // fills hidden and opens around planes of a row (64 cells at a time), and clears its opening plane
+    auto fillRow = [&](const int y) {
+        const Cell* const cellRow = this->cellRow_(y);
+        Word* const hiddenRow = rowOf(hiddenBits, y);
+        Word* const opensAroundRow = rowOf(opensAroundBits, y);
+        for (int i = 0; i < numOfWords; ++i) {
+            const int firstX = i * bitboard::WORD_BITS;
+            Cell::openingBitPlanes(cellRow + firstX, std::min(bitboard::WORD_BITS, width - firstX), hiddenRow[i],
+                                   opensAroundRow[i]);
+        }
+        std::fill(rowOf(openingBits, y), rowOf(openingBits, y) + numOfWords, 0);
+    };
+
+    // filled rows (from 'filledTop' to 'filledBottom') grow with the opening, which is connected,
+    // hence a single range of rows is enough, and the cost of the fill follows the height of the opening
+    int filledTop = checkedY;
+    int filledBottom = checkedY;
+    fillRow(checkedY);
+    rowOf(openingBits, checkedY)[checkedX / bitboard::WORD_BITS] |=
+        Word{1} << static_cast<unsigned>(checkedX % bitboard::WORD_BITS);
+    auto fillRows = [&](const int firstY, const int lastY) {
+        while (filledTop > std::max(firstY, 0)) {
+            fillRow(--filledTop);
+        }
+        while (filledBottom < std::min(lastY, height - 1)) {
+            fillRow(++filledBottom);
+        }
+    };
+
+    // grows row y with cells connected to the opening on the same row, or on rows above and below,
+    // returns whether row y changed
+    auto growRow = [&](const int y) {
+        fillRows(y - 1, y + 1);
+        Word* const row = rowOf(openingBits, y);
+        for (int i = 0; i < numOfWords; ++i) {
+            scratchRow[i] = (y > 0 ? rowOf(openingBits, y - 1)[i] : 0) |
+                            (y < height - 1 ? rowOf(openingBits, y + 1)[i] : 0);
+        }
+        bitboard::dilateRow(scratchRow, seedRow, numOfWords);
+        for (int i = 0; i < numOfWords; ++i) {
+            seedRow[i] |= row[i];
+        }
+        bitboard::fillRuns(seedRow, rowOf(opensAroundBits, y), scratchRow, numOfWords);
+
+        bool changed = false;
+        for (int i = 0; i < numOfWords; ++i) {
+            changed = changed || scratchRow[i] != row[i];
+            row[i] = scratchRow[i];
+        }
+        if (changed) {
+            topRow = std::min(topRow, y);
+            bottomRow = std::max(bottomRow, y);
+        }
+        return changed;
+    };
+
+    // alternating downwards and upwards sweeps until fixed point
+    // (rows next to the opening are included, so the sweeps extend as the opening grows)
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int y = std::max(topRow - 1, 0); y <= std::min(bottomRow + 1, height - 1); ++y) {
+            changed = growRow(y) || changed;
+        }
+        for (int y = std::min(bottomRow + 1, height - 1); y >= std::max(topRow - 1, 0); --y) {
+            changed = growRow(y) || changed;
+        }
+    }
+
+    // to reveal hidden cells in and around the opening
+    fillRows(topRow - 2, bottomRow + 2);
+    for (int y = std::max(topRow - 1, 0); y <= std::min(bottomRow + 1, height - 1); ++y) {
+        for (int i = 0; i < numOfWords; ++i) {
+            scratchRow[i] = rowOf(openingBits, y)[i] | (y > 0 ? rowOf(openingBits, y - 1)[i] : 0) |
+                            (y < height - 1 ? rowOf(openingBits, y + 1)[i] : 0);
+        }
+        bitboard::dilateRow(scratchRow, seedRow, numOfWords);
+
+        const Word* const hiddenRow = rowOf(hiddenBits, y);
+        Cell* const cellRow = this->mutableCellRow_(y);
+        for (int i = 0; i < numOfWords; ++i) {
+            Word revealedBits = seedRow[i] & hiddenRow[i];
+            while (revealedBits != 0) {
+                const int x = i * bitboard::WORD_BITS + bitboard::countTrailingZeros(revealedBits);
+                revealedBits &= revealedBits - 1;
+                this->revealCell_(cellRow[x], this->cellIndex_(x, y));
+            }
+        }
+    }
+}
+
+void Game::completeAroundInputCoordinates(const int x, const int y, std::vector<CellChange>& changes) {
+
+    const CellChangeRecording recording(this->_cellChanges, changes);
+    this->completeAroundInputCoordinates(x, y);
+}
+
 void Game::completeAroundInputCoordinates(const int x, const int y) {
 
     if (x < 0 || y < 0 || x >= this->_gridWidth || y >= this->_gridHeight) {
@@ -649,6 +1276,11 @@ void Game::completeAroundInputCoordinates(const int x, const int y) {
                                     "Trying to complete around a cell that is not visible.");
     }
 
+    this->recordAction_(Action{ActionType::COMPLETE_AROUND, x, y, false, 0, 0, 0});
+
+    const LatencyTimer latencyTimer(this->_latencyRecorder, LatencyOperation::COMPLETE_AROUND, this->_gridHeight,
+                                    this->_gridWidth);
+
     // if cell has a mine
     //   OR the number of marked mines around cell does not match the actual number of mines around cell,
     // do nothing
@@ -656,64 +1288,79 @@ void Game::completeAroundInputCoordinates(const int x, const int y) {
     if (!this->doesCellHaveMine_(x, y) &&
         (this->numOfMarkedCellsAroundCell_(x, y) == this->numOfMinesAroundCell_(x, y))) {
 
-        this->checkAroundCoordinate_(x, y);
-
-        this->handleCellCoordsToCheckQueue_();
+        this->beginMove_();
+        this->forEachNeighbour_(this->cellIndex_(x, y),
+                                [this](const int neighbourIndex) { this->checkCell_(neighbourIndex); });
+        this->endMove_();
     }
 }
 
 int Game::numOfMarkedCellsAroundCell_(const int x, const int y) const {
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
     int output = 0;
-    for (auto const& neighbourCell : this->neighbourCells_(x, y)) {
-        if (this->isCellMarked_(neighbourCell.first, neighbourCell.second)) {
+    this->forEachNeighbour_(this->cellIndex_(x, y), [this, &output](const int neighbourIndex) {
+        if (this->cell_(neighbourIndex).isMarked()) {
             ++output;
         }
-    }
+    });
     return output;
 }
 
-std::vector<std::pair<int, int>> Game::neighbourCells_(const int x, const int y) const {
+int Game::getGridHeight() const { return this->_gridHeight; }
 
-    assert(x >= 0 && y >= 0 && x < this->_gridWidth && y < this->_gridHeight);
-    std::vector<std::pair<int, int>> neighbours;
+int Game::getGridWidth() const { return this->_gridWidth; }
 
-    if (x > 0) {
-        neighbours.emplace_back(x - 1, y); // left
-    }
-    if (x < this->_gridWidth - 1) {
-        neighbours.emplace_back(x + 1, y); // right
-    }
-    if (y > 0) {
-        neighbours.emplace_back(x, y - 1); // top
-    }
-    if (y < this->_gridHeight - 1) {
-        neighbours.emplace_back(x, y + 1); // bottom
-    }
-    if (x > 0 && y > 0) {
-        neighbours.emplace_back(x - 1, y - 1); // top left
-    }
-    if (y > 0 && x < this->_gridWidth - 1) {
-        neighbours.emplace_back(x + 1, y - 1); // top right
-    }
-    if (y < this->_gridHeight - 1 && x > 0) {
-        neighbours.emplace_back(x - 1, y + 1); // bottom left
+int Game::getNumOfMines() const { return this->_numOfMines; }
+
+RevealEngine Game::getRevealEngine() const { return this->_revealEngine; }
+
+void Game::setGenerationSeed(const std::uint64_t seed) {
+
+    // (log holds a single seed, which replays every mine layout of the log)
+    if (this->_actionLog != nullptr) {
+        if (this->recordedActionsHaveCreatedMines_()) {
+            throw std::invalid_argument("Game::setGenerationSeed(std::uint64_t seed): "
+                                        "Trying to change generation seed, while recorded actions have created mines.");
+        }
+        this->_actionLog->setGenerationSeed(seed);
     }
-    if (x < this->_gridWidth - 1 && y < this->_gridHeight - 1) {
-        neighbours.emplace_back(x + 1, y + 1); // bottom right
+
+    this->_hasGenerationSeed = true;
+    this->_generationSeed = seed;
+}
+
+void Game::clearGenerationSeed() {
+
+    if (this->_actionLog != nullptr) {
+        if (this->recordedActionsHaveCreatedMines_()) {
+            throw std::invalid_argument("Game::clearGenerationSeed(): "
+                                        "Trying to change generation seed, while recorded actions have created mines.");
+        }
+        this->_actionLog->clearGenerationSeed();
     }
 
-    return neighbours;
+    this->_hasGenerationSeed = false;
+    this->_generationSeed = 0;
 }
 
-int Game::getGridHeight() const { return this->_gridHeight; }
+bool Game::hasGenerationSeed() const { return this->_hasGenerationSeed; }
 
-int Game::getGridWidth() const { return this->_gridWidth; }
+std::uint64_t Game::getGenerationSeed() const { return this->_generationSeed; }
 
-int Game::getNumOfMines() const { return this->_numOfMines; }
+std::ostream& Game::serialise(std::ostream& outStream, const SerialisationFormat format) const {
+
+    if (format == SerialisationFormat::BINARY || format == SerialisationFormat::SEED_BASED) {
+        // (written bytes are counted by the writers, once they know the size)
+        return format == SerialisationFormat::SEED_BASED ? this->serialiseSeedBased_(outStream)
+                                                         : this->serialiseBinary_(outStream);
+    }
+
+    this->countBytesSerialised_(this->serialiseJson_(outStream, format == SerialisationFormat::JSON));
+
+    return outStream;
+}
 
-std::ostream& Game::serialise(std::ostream& outStream) const {
+std::size_t Game::serialiseJson_(std::ostream& outStream, const bool prettyPrint) const {
 
     // current serialisation magic and version:
     const std::string CURRENT_SERIALISATION_MAGIC = "Timi's Minesweeper";
@@ -723,127 +1370,356 @@ std::ostream& Game::serialise(std::ostream& outStream) const {
     // | Start of serialisation: |
     // +-------------------------+
 
-    nlohmann::json j;
+    // (keys are written in sorted order, which is the order 'nlohmann::json' objects keep them in,
+    // so that output is identical to output of 'nlohmann::json' documents of earlier versions)
+    JsonStreamWriter writer(outStream, prettyPrint);
 
-    // magic and version information:
-    j[MAGIC_KEY] = CURRENT_SERIALISATION_MAGIC;
-    j[VERSION_KEY] = CURRENT_SERIALISATION_VERSION;
+    writer.beginObject();
 
     // current game fields:
-    j[CURRENT_GAME_KEY][GRID_HEIGHT_KEY] = this->_gridHeight;
-    j[CURRENT_GAME_KEY][GRID_WIDTH_KEY] = this->_gridWidth;
-    j[CURRENT_GAME_KEY][NUM_OF_MINES_KEY] = this->_numOfMines;
-    j[CURRENT_GAME_KEY][NUM_OF_MARKED_MINES_KEY] = this->_numOfMarkedMines;
-    j[CURRENT_GAME_KEY][NUM_OF_WRONGLY_MARKED_CELLS_KEY] = this->_numOfWronglyMarkedCells;
-    j[CURRENT_GAME_KEY][NUM_OF_VISIBLE_CELLS_KEY] = this->_numOfVisibleCells;
-    j[CURRENT_GAME_KEY][CHECKED_MINE_KEY] = this->_checkedMine;
-    j[CURRENT_GAME_KEY][MINES_HAVE_BEEN_SET_KEY] = this->_minesHaveBeenSet;
+    writer.key(CURRENT_GAME_KEY);
+    writer.beginObject();
+    writer.key(CHECKED_MINE_KEY);
+    writer.value(this->_checkedMine);
 
     // cell data:
     if (this->_gridHeight != 0 && this->_gridWidth != 0) {
+        writer.key(CELLS_KEY);
+        writer.beginArray();
         for (int y = 0; y < this->_gridHeight; ++y) {
 
-            nlohmann::json jRowObject;
-            jRowObject[ROW_NUMBER_KEY] = y;
-
+            writer.beginObject();
+            writer.key(ROW_CELLS_KEY);
+            writer.beginArray();
             for (int x = 0; x < this->_gridWidth; ++x) {
 
-                nlohmann::json jCellObject;
-                jCellObject[COLUMN_NUMBER_KEY] = x;
+                writer.beginObject();
+                writer.key(CELL_KEY);
+                this->cellAt_(x, y).serialise(writer);
+                writer.key(COLUMN_NUMBER_KEY);
+                writer.value(x);
+                writer.endObject();
+            }
+            writer.endArray();
+            writer.key(ROW_NUMBER_KEY);
+            writer.value(y);
+            writer.endObject();
+        }
+        writer.endArray();
+    }
 
-                jCellObject[CELL_KEY] = this->_cells[y][x]->serialise();
+    writer.key(GRID_HEIGHT_KEY);
+    writer.value(this->_gridHeight);
+    writer.key(GRID_WIDTH_KEY);
+    writer.value(this->_gridWidth);
+    writer.key(MINES_HAVE_BEEN_SET_KEY);
+    writer.value(this->_minesHaveBeenSet);
+    writer.key(NUM_OF_MARKED_MINES_KEY);
+    writer.value(this->_numOfMarkedMines);
+    writer.key(NUM_OF_MINES_KEY);
+    writer.value(this->_numOfMines);
+    writer.key(NUM_OF_VISIBLE_CELLS_KEY);
+    writer.value(this->_numOfVisibleCells);
+    writer.key(NUM_OF_WRONGLY_MARKED_CELLS_KEY);
+    writer.value(this->_numOfWronglyMarkedCells);
+    writer.endObject();
 
-                jRowObject[ROW_CELLS_KEY].push_back(jCellObject);
-            }
+    // magic and version information:
+    writer.key(MAGIC_KEY);
+    writer.value(CURRENT_SERIALISATION_MAGIC);
+    writer.key(VERSION_KEY);
+    writer.value(CURRENT_SERIALISATION_VERSION);
+
+    writer.endObject();
+    writer.flush();
+
+    outStream << std::endl;
+
+    // (including the new line)
+    return writer.numOfBytesWritten() + 1;
+}
+
+std::size_t Game::serialise(char* const output, const std::size_t outputSize, const SerialisationFormat format) const {
+
+    // binary formats are written straight into the memory
+    if (format == SerialisationFormat::BINARY || format == SerialisationFormat::SEED_BASED) {
+        const bool isSeedBased = format == SerialisationFormat::SEED_BASED;
+        const std::size_t size = this->binarySerialisationSize_(isSeedBased);
+        if (outputSize < size) {
+            throw std::invalid_argument("Game::serialise(char* output, std::size_t outputSize, SerialisationFormat "
+                                        "format): Output size is smaller than size of serialisation.");
+        }
 
-            j[CURRENT_GAME_KEY][CELLS_KEY].push_back(jRowObject);
+        auto* const binaryOutput = reinterpret_cast<unsigned char*>(output);
+        if (isSeedBased) {
+            this->serialiseSeedBased_(binaryOutput, size);
+        } else {
+            this->serialiseBinary_(binaryOutput);
         }
+        this->countBytesSerialised_(size);
+        return size;
     }
 
-    outStream << std::setw(4) << j << std::endl;
+    // (JSON does not fit, if writing into the memory fails)
+    MemoryStreamBuffer buffer(output, outputSize);
+    std::ostream outStream(&buffer);
+    this->serialiseJson_(outStream, format == SerialisationFormat::JSON);
+    if (!outStream) {
+        throw std::invalid_argument("Game::serialise(char* output, std::size_t outputSize, SerialisationFormat "
+                                    "format): Output size is smaller than size of serialisation.");
+    }
 
-    return outStream;
+    this->countBytesSerialised_(buffer.numOfBytesWritten());
+    return buffer.numOfBytesWritten();
+}
+
+std::size_t Game::serialisationSize(const SerialisationFormat format) const {
+
+    if (format == SerialisationFormat::BINARY || format == SerialisationFormat::SEED_BASED) {
+        return this->binarySerialisationSize_(format == SerialisationFormat::SEED_BASED);
+    }
+
+    CountingStreamBuffer buffer;
+    std::ostream outStream(&buffer);
+    return this->serialiseJson_(outStream, format == SerialisationFormat::JSON);
 }
 
 std::istream& Game::deserialise(std::istream& inStream) {
 
-    // this method assigns field straight away,
-    // hence it cannot be trusted to leave Game in valid state if and error occurs.
+    if (isBinarySerialisation_(inStream)) {
+        return this->deserialiseBinary_(inStream);
+    }
 
-    // current serialisation magic and version:
-    const std::string CURRENT_SERIALISATION_MAGIC = "Timi's Minesweeper";
-    const std::string CURRENT_SERIALISATION_VERSION = "1.0";
+    // cells are loaded as the serialisation is parsed (without building a 'nlohmann::json' document),
+    // and fields are assigned only after the whole serialisation has been read and verified
+    JsonLoader loader;
+    nlohmann::json::sax_parse(inStream, &loader, nlohmann::json::input_format_t::json, false); // throws
 
-    try {
-
-        nlohmann::json j;
-        inStream >> j;
-
-        if (j.at(MAGIC_KEY) == CURRENT_SERIALISATION_MAGIC) {
-            if (j.at(VERSION_KEY) == CURRENT_SERIALISATION_VERSION) {
-
-                // current game fields:
-                int newGridHeight = verifyGridDimension_(j.at(CURRENT_GAME_KEY).at(GRID_HEIGHT_KEY));
-                int newGridWidth = verifyGridDimension_(j.at(CURRENT_GAME_KEY).at(GRID_WIDTH_KEY));
-                int newNumOfMines =
-                    verifyNumOfMines_(j.at(CURRENT_GAME_KEY).at(NUM_OF_MINES_KEY), newGridHeight, newGridWidth);
-                int newNumOfMarkedMines =
-                    verifyNumOfMarkedMines_(j.at(CURRENT_GAME_KEY).at(NUM_OF_MARKED_MINES_KEY), newNumOfMines);
-                int newNumOfWronglyMarkedCells =
-                    verifyNumOfWronglyMarkedCells_(j.at(CURRENT_GAME_KEY).at(NUM_OF_WRONGLY_MARKED_CELLS_KEY),
-                                                   newGridHeight, newGridWidth, newNumOfMines);
-                int newNumOfVisibleCells = verifyNumOfVisibleCells_(j.at(CURRENT_GAME_KEY).at(NUM_OF_VISIBLE_CELLS_KEY),
-                                                                    newGridHeight, newGridWidth);
-                bool newCheckedMine = j.at(CURRENT_GAME_KEY).at(CHECKED_MINE_KEY);
-                bool newMinesHaveBeenSet = j.at(CURRENT_GAME_KEY).at(MINES_HAVE_BEEN_SET_KEY);
-
-                this->_gridHeight = newGridHeight;
-                this->_gridWidth = newGridWidth;
-                this->_numOfMines = newNumOfMines;
-                this->_numOfMarkedMines = newNumOfMarkedMines;
-                this->_numOfWronglyMarkedCells = newNumOfWronglyMarkedCells;
-                this->_numOfVisibleCells = newNumOfVisibleCells;
-                this->_checkedMine = newCheckedMine;
-                this->_minesHaveBeenSet = newMinesHaveBeenSet;
-
-                // resize cells/grid to accept their data
-                this->resizeCells_(newGridHeight, newGridWidth);
-
-                // cell data:
-                if (this->_gridHeight != 0 && this->_gridWidth != 0) {
-                    for (auto& jRowObject : j.at(CURRENT_GAME_KEY).at(CELLS_KEY)) {
-
-                        const int Y = jRowObject.at(ROW_NUMBER_KEY);
-
-                        for (auto& jCellObject : jRowObject.at(ROW_CELLS_KEY)) {
-
-                            const int X = jCellObject.at(COLUMN_NUMBER_KEY);
-
-                            this->_cells[Y][X]->deserialise(jCellObject.at(CELL_KEY));
-                        }
-                    }
-                }
-            } else {
-                throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid version number: " +
-                                            j.at("version").get<std::string>());
-            }
-        } else {
-            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid magic: " +
-                                        j.at("magic").get<std::string>());
+    loader.load(*this);
+
+    return inStream;
+}
+
+std::size_t Game::deserialise(const char* const input, const std::size_t inputSize) {
+
+    const auto* const binaryInput = reinterpret_cast<const unsigned char*>(input);
+    if (isBinarySerialisation_(binaryInput, inputSize)) {
+        return this->deserialiseBinary_(binaryInput, inputSize);
+    }
+
+    // (whitespace after JSON, like the new line written by 'serialise', is read as well)
+    MemoryStreamBuffer buffer(input, inputSize);
+    std::istream inStream(&buffer);
+    this->deserialise(inStream);
+    inStream >> std::ws;
+
+    return buffer.numOfBytesRead();
+}
+
+void Game::enableMoveJournal() {
+    if (this->_moveJournal == nullptr) {
+        this->_moveJournal = std::make_unique<MoveJournal>();
+    }
+}
+
+void Game::disableMoveJournal() { this->_moveJournal = nullptr; }
+
+bool Game::isMoveJournalEnabled() const { return this->_moveJournal != nullptr; }
+
+bool Game::canUndoMove() const { return this->_moveJournal != nullptr && this->_moveJournal->canUndo(); }
+
+bool Game::canRedoMove() const { return this->_moveJournal != nullptr && this->_moveJournal->canRedo(); }
+
+void Game::undoMove(std::vector<CellChange>& changes) {
+
+    const CellChangeRecording recording(this->_cellChanges, changes);
+    this->undoMove();
+}
+
+void Game::undoMove() {
+
+    if (!this->canUndoMove()) {
+        throw std::out_of_range("Game::undoMove(): There are no moves to undo.");
+    }
+
+    this->recordAction_(Action{ActionType::UNDO, 0, 0, false, 0, 0, 0});
+
+    // cell changes are reverted in reverse order
+    const MoveJournal::Move& move = this->_moveJournal->undo();
+    for (std::size_t i = move.endCellChange; i != move.firstCellChange; --i) {
+        const MoveJournal::JournalledCellChange& change = this->_moveJournal->cellChange(i - 1);
+        Cell& cell = this->mutableCell_(change.cellIndex);
+
+        switch (change.type) {
+        case MoveJournal::CellChangeType::REVEAL:
+            cell.makeHidden();
+            // (deltas can not hide cells, hence the next one holds the whole grid)
+            this->_gridChanged = true;
+            break;
+        case MoveJournal::CellChangeType::MARK:
+            cell.unmarkCell();
+            break;
+        case MoveJournal::CellChangeType::UNMARK:
+            cell.markCell();
+            break;
         }
 
-    } catch (nlohmann::json::parse_error& ex) {
-        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument is not valid JSON.\n\t" +
-                                    std::string(ex.what()));
-    } catch (nlohmann::json::type_error& ex) {
-        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument is not a JSON object.\n\t" +
-                                    std::string(ex.what()));
-    } catch (nlohmann::json::out_of_range& ex) {
-        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument key does not exist.\n\t" +
-                                    std::string(ex.what()));
+        this->markRowChanged_(change.cellIndex);
+        this->addCellChange_(change.cellIndex);
     }
 
-    return inStream;
+    this->_numOfMarkedMines = move.countersBefore.numOfMarkedMines;
+    this->_numOfWronglyMarkedCells = move.countersBefore.numOfWronglyMarkedCells;
+    this->_numOfVisibleCells = move.countersBefore.numOfVisibleCells;
+    this->_checkedMine = move.countersBefore.checkedMine;
+}
+
+void Game::redoMove(std::vector<CellChange>& changes) {
+
+    const CellChangeRecording recording(this->_cellChanges, changes);
+    this->redoMove();
+}
+
+void Game::redoMove() {
+
+    if (!this->canRedoMove()) {
+        throw std::out_of_range("Game::redoMove(): There are no moves to redo.");
+    }
+
+    this->recordAction_(Action{ActionType::REDO, 0, 0, false, 0, 0, 0});
+
+    const MoveJournal::Move& move = this->_moveJournal->redo();
+    for (std::size_t i = move.firstCellChange; i != move.endCellChange; ++i) {
+        const MoveJournal::JournalledCellChange& change = this->_moveJournal->cellChange(i);
+        Cell& cell = this->mutableCell_(change.cellIndex);
+
+        switch (change.type) {
+        case MoveJournal::CellChangeType::REVEAL:
+            cell.makeVisible();
+            break;
+        case MoveJournal::CellChangeType::MARK:
+            cell.markCell();
+            break;
+        case MoveJournal::CellChangeType::UNMARK:
+            cell.unmarkCell();
+            break;
+        }
+
+        this->markRowChanged_(change.cellIndex);
+        this->addCellChange_(change.cellIndex);
+    }
+
+    this->_numOfMarkedMines = move.countersAfter.numOfMarkedMines;
+    this->_numOfWronglyMarkedCells = move.countersAfter.numOfWronglyMarkedCells;
+    this->_numOfVisibleCells = move.countersAfter.numOfVisibleCells;
+    this->_checkedMine = move.countersAfter.checkedMine;
+}
+
+void Game::beginMove_() {
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->beginMove(MoveJournal::Counters{this->_numOfMarkedMines, this->_numOfWronglyMarkedCells,
+                                                            this->_numOfVisibleCells, this->_checkedMine});
+    }
+}
+
+void Game::endMove_() {
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->endMove(MoveJournal::Counters{this->_numOfMarkedMines, this->_numOfWronglyMarkedCells,
+                                                          this->_numOfVisibleCells, this->_checkedMine});
+    }
+}
+
+void Game::clearMoveJournal_() {
+    if (this->_moveJournal != nullptr) {
+        this->_moveJournal->clear();
+    }
+}
+
+void Game::recordActions(ActionLog* const actionLog) {
+
+    if (actionLog != nullptr) {
+        if (this->_minesHaveBeenSet) {
+            throw std::invalid_argument("Game::recordActions(ActionLog* actionLog): "
+                                        "Trying to start recording actions of a game, whose mines have been created. "
+                                        "\n\t(Start recording before the first check, or after resetting the game.)");
+        }
+
+        actionLog->start(this->_gridHeight, this->_gridWidth, this->_numOfMines);
+        if (this->_hasGenerationSeed) {
+            actionLog->setGenerationSeed(this->_generationSeed);
+        }
+    }
+
+    this->_actionLog = actionLog;
+}
+
+bool Game::isRecordingActions() const { return this->_actionLog != nullptr; }
+
+void Game::recordAction_(const Action& action) {
+    if (this->_actionLog != nullptr) {
+        this->_actionLog->append(action);
+    }
+}
+
+bool Game::recordedActionsHaveCreatedMines_() const {
+
+    // (recording starts before mines are created, and only checks and creating mines can create them)
+    const std::vector<Action>& actions = this->_actionLog->getActions();
+    return std::any_of(actions.begin(), actions.end(), [](const Action& action) {
+        return action.type == ActionType::CHECK || action.type == ActionType::CREATE_MINES;
+    });
+}
+
+void Game::recordLatencies(LatencyRecorder* const latencyRecorder) { this->_latencyRecorder = latencyRecorder; }
+
+bool Game::isRecordingLatencies() const { return this->_latencyRecorder != nullptr; }
+
+GameStats Game::stats() const {
+#ifdef MINESWEEPER_STATS
+    GameStats stats = this->_stats;
+    stats.numOfBytesSerialised = this->_numOfBytesSerialised.load(std::memory_order_relaxed);
+    return stats;
+#else
+    return GameStats{};
+#endif
+}
+
+void Game::resetStats() {
+#ifdef MINESWEEPER_STATS
+    this->_stats = GameStats{};
+    this->_numOfBytesSerialised.store(0, std::memory_order_relaxed);
+#endif
+}
+
+// static method
+bool Game::statsAreEnabled() {
+#ifdef MINESWEEPER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Game::checkpoint() {
+
+    this->_changedRows.assign(static_cast<std::size_t>(bitboard::numOfWords(this->_gridHeight)), 0);
+    this->_gridChanged = false;
+}
+
+std::size_t Game::applyDelta(const char* const input, const std::size_t inputSize) {
+    return this->applyDelta_(reinterpret_cast<const unsigned char*>(input), inputSize);
+}
+
+// static method
+std::ostream& Game::compactDeltas(std::istream& inStream, std::ostream& outStream, const SerialisationFormat format) {
+
+    Game game;
+    game.deserialise(inStream);
+    while ((inStream >> std::ws).peek() != std::char_traits<char>::eof()) {
+        game.applyDelta(inStream);
+    }
+
+    return game.serialise(outStream, format);
 }
 
 // static method
@@ -0,0 +1,771 @@
+#include <algorithm> // std::fill_n, std::min
+#include <climits>   // INT_MAX
+#include <cstddef>   // std::ptrdiff_t, std::size_t
+#include <cstdint>   // std::uint16_t, std::uint32_t, std::uint64_t
+#include <iostream>  // std::istream, std::ostream, std::streamsize
+#include <stdexcept> // std::invalid_argument
+#include <string>    // std::string, std::char_traits, std::to_string
+#include <vector>    // std::vector
+
+#include <minesweeper/binary_encoding.h>
+#include <minesweeper/bitboard.h>
+#include <minesweeper/cell.h>
+#include <minesweeper/fast_random.h>
+#include <minesweeper/game.h>
+
+// binary serialisation of 'Game' (all numbers little-endian):
+//
+// header:
+//   bytes  0-3:  magic (0x89 'T' 'M' 'S', first byte of which can not start JSON)
+//   bytes  4-5:  version
+//   bytes  6-7:  flags (bit 0: checked mine, bit 1: mines have been set, bit 2: seed-based body)
+//   bytes  8-31: grid height, grid width, number of mines, number of marked mines,
+//                number of wrongly marked cells, number of visible cells (32 bits each)
+//   bytes 32-39: checksum of bytes 0-31
+// body:
+//   visible, mine and marked bit planes (64-bit words, each row of the grid starting from a new word),
+//   followed by checksum of the bit planes (64 bits)
+//
+// seed-based body (instead of bit planes):
+//   bytes  0-7:  seed of mine layout
+//   bytes  8-15: first checked x and y coordinates (32 bits each, 0xFFFFFFFF if mines have not been set)
+//   bytes 16-19: size of runs in bytes
+//   runs of cell states (bit 0: visible, bit 1: marked), each a varint of ((length of run - 1) << 2 | state),
+//   followed by checksum of the seed-based body (64 bits)
+//
+// delta (rows changed since a checkpoint):
+//   header like above, except magic (0x89 'T' 'M' 'D') and flags (bit 3: full delta)
+//   bytes  0-3:  number of rows in the delta
+//   rows, each a row number (32 bits) followed by visible and marked 64-bit words of the row
+//   (and mine words, if it is a full delta, which has every row of the grid),
+//   followed by checksum of the delta body (64 bits)
+//
+// numbers of mines around cells are not stored, but counted from the mine bit plane when loading
+// (and mines of seed-based serialisations are recreated from the seed and first checked cell)
+
+namespace minesweeper {
+
+namespace {
+
+using binary_encoding::checksum;
+using binary_encoding::loadLittleEndian;
+using binary_encoding::storeLittleEndian;
+
+const unsigned char BINARY_MAGIC[4] = {0x89, 'T', 'M', 'S'};
+const unsigned char DELTA_MAGIC[4] = {0x89, 'T', 'M', 'D'};
+const std::uint16_t BINARY_VERSION = 1;
+
+const std::size_t BINARY_HEADER_SIZE = 40;
+const std::size_t BINARY_HEADER_CHECKSUM_OFFSET = 32;
+const std::size_t BINARY_CHECKSUM_SIZE = 8;
+const int NUM_OF_BIT_PLANES = 3;
+
+const std::uint16_t CHECKED_MINE_FLAG = 0x1;
+const std::uint16_t MINES_HAVE_BEEN_SET_FLAG = 0x2;
+const std::uint16_t SEED_BASED_FLAG = 0x4;
+const std::uint16_t FULL_DELTA_FLAG = 0x8;
+
+const std::size_t SEED_BASED_FIELDS_SIZE = 20;
+const std::uint32_t NO_FIRST_CHECKED_CELL = 0xFFFFFFFF;
+const int VISIBLE_STATE = 0x1;
+const int MARKED_STATE = 0x2;
+
+const std::size_t DELTA_FIELDS_SIZE = 4;
+
+std::size_t bitPlaneSize(const int gridHeight, const int gridWidth) {
+    return static_cast<std::size_t>(gridHeight) * bitboard::numOfWords(gridWidth) * sizeof(bitboard::Word);
+}
+
+std::size_t binaryBodySize(const int gridHeight, const int gridWidth) {
+    return NUM_OF_BIT_PLANES * bitPlaneSize(gridHeight, gridWidth) + BINARY_CHECKSUM_SIZE;
+}
+
+std::size_t deltaRowSize(const int gridWidth, const bool isFullDelta) {
+    return 4 + (isFullDelta ? 3 : 2) * bitboard::numOfWords(gridWidth) * sizeof(bitboard::Word);
+}
+
+// stores varint and returns its size (only counts its size, if 'output' is null)
+std::size_t storeVarint(unsigned char* const output, std::uint64_t value) {
+    std::size_t size = 1;
+    for (; value >= 0x80; value >>= 7U, ++size) {
+        if (output != nullptr) {
+            output[size - 1] = static_cast<unsigned char>(value | 0x80U);
+        }
+    }
+    if (output != nullptr) {
+        output[size - 1] = static_cast<unsigned char>(value);
+    }
+    return size;
+}
+
+// (returns false, if the varint does not end before 'end' or is too long)
+bool readVarint(const unsigned char*& input, const unsigned char* const end, std::uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; input != end && shift < 64; shift += 7) {
+        const unsigned char byte = *input++;
+        value |= std::uint64_t{byte & 0x7FU} << shift;
+        if ((byte & 0x80U) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::size_t storeRun(unsigned char* const output, const std::uint64_t length, const int state) {
+    return storeVarint(output, ((length - 1) << 2U) | static_cast<std::uint64_t>(state));
+}
+
+} // namespace
+
+void Game::serialiseBinaryHeader_(unsigned char* const output, const unsigned char* const magic,
+                                  const std::uint16_t formatFlags) const {
+
+    const std::uint16_t flags = (this->_checkedMine ? CHECKED_MINE_FLAG : 0) |
+                                (this->_minesHaveBeenSet ? MINES_HAVE_BEEN_SET_FLAG : 0) | formatFlags;
+    for (int i = 0; i < 4; ++i) {
+        output[i] = magic[i];
+    }
+    storeLittleEndian(output + 4, BINARY_VERSION, 2);
+    storeLittleEndian(output + 6, flags, 2);
+    storeLittleEndian(output + 8, static_cast<std::uint32_t>(this->_gridHeight), 4);
+    storeLittleEndian(output + 12, static_cast<std::uint32_t>(this->_gridWidth), 4);
+    storeLittleEndian(output + 16, static_cast<std::uint32_t>(this->_numOfMines), 4);
+    storeLittleEndian(output + 20, static_cast<std::uint32_t>(this->_numOfMarkedMines), 4);
+    storeLittleEndian(output + 24, static_cast<std::uint32_t>(this->_numOfWronglyMarkedCells), 4);
+    storeLittleEndian(output + 28, static_cast<std::uint32_t>(this->_numOfVisibleCells), 4);
+    storeLittleEndian(output + BINARY_HEADER_CHECKSUM_OFFSET, checksum(output, BINARY_HEADER_CHECKSUM_OFFSET), 8);
+}
+
+void Game::serialiseBinary_(unsigned char* const output) const {
+
+    using bitboard::Word;
+
+    this->serialiseBinaryHeader_(output, BINARY_MAGIC, 0);
+
+    // bit planes:
+    unsigned char* const visiblePlane = output + BINARY_HEADER_SIZE;
+    unsigned char* const minePlane = visiblePlane + bitPlaneSize(this->_gridHeight, this->_gridWidth);
+    unsigned char* const markedPlane = minePlane + bitPlaneSize(this->_gridHeight, this->_gridWidth);
+
+    const int numOfWords = bitboard::numOfWords(this->_gridWidth);
+    for (int y = 0; y < this->_gridHeight; ++y) {
+        const Cell* const cellRow = this->cellRow_(y);
+
+        for (int i = 0; i < numOfWords; ++i) {
+            const int firstX = i * bitboard::WORD_BITS;
+            Word visibleBits = 0;
+            Word mineBits = 0;
+            Word markedBits = 0;
+            Cell::bitPlanes(&cellRow[firstX], std::min(bitboard::WORD_BITS, this->_gridWidth - firstX), visibleBits,
+                            mineBits, markedBits);
+
+            const std::size_t offset = (static_cast<std::size_t>(y) * numOfWords + i) * sizeof(Word);
+            storeLittleEndian(visiblePlane + offset, visibleBits, 8);
+            storeLittleEndian(minePlane + offset, mineBits, 8);
+            storeLittleEndian(markedPlane + offset, markedBits, 8);
+        }
+    }
+
+    const std::size_t bitPlanesSize = NUM_OF_BIT_PLANES * bitPlaneSize(this->_gridHeight, this->_gridWidth);
+    storeLittleEndian(visiblePlane + bitPlanesSize, checksum(visiblePlane, bitPlanesSize), 8);
+}
+
+std::ostream& Game::serialiseBinary_(std::ostream& outStream) const {
+
+    std::vector<unsigned char> output(this->binarySerialisationSize_(false));
+    this->serialiseBinary_(output.data());
+    outStream.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+    this->countBytesSerialised_(output.size());
+
+    return outStream;
+}
+
+std::size_t Game::binarySerialisationSize_(const bool isSeedBased) const {
+    if (!isSeedBased) {
+        return BINARY_HEADER_SIZE + binaryBodySize(this->_gridHeight, this->_gridWidth);
+    }
+    return BINARY_HEADER_SIZE + SEED_BASED_FIELDS_SIZE + this->serialiseCellStateRuns_(nullptr) +
+           BINARY_CHECKSUM_SIZE;
+}
+
+std::size_t Game::serialiseCellStateRuns_(unsigned char* const output) const {
+
+    using bitboard::Word;
+
+    // runs of cell states in row-major order (border cells are skipped):
+    std::size_t size = 0;
+    int runState = 0;
+    std::uint64_t runLength = 0;
+    for (int y = 0; y < this->_gridHeight; ++y) {
+        const Cell* const cellRow = this->cellRow_(y);
+
+        for (int firstX = 0; firstX < this->_gridWidth; firstX += bitboard::WORD_BITS) {
+            const int numOfCells = std::min(bitboard::WORD_BITS, this->_gridWidth - firstX);
+            Word visibleBits = 0;
+            Word mineBits = 0;
+            Word markedBits = 0;
+            Cell::bitPlanes(&cellRow[firstX], numOfCells, visibleBits, mineBits, markedBits);
+
+            for (int i = 0; i < numOfCells; ++i) {
+                const int state = static_cast<int>((visibleBits >> i) & 1U) * VISIBLE_STATE |
+                                  static_cast<int>((markedBits >> i) & 1U) * MARKED_STATE;
+                if (state != runState && runLength != 0) {
+                    size += storeRun(output != nullptr ? output + size : nullptr, runLength, runState);
+                    runLength = 0;
+                }
+                runState = state;
+                ++runLength;
+            }
+        }
+    }
+    if (runLength != 0) {
+        size += storeRun(output != nullptr ? output + size : nullptr, runLength, runState);
+    }
+
+    return size;
+}
+
+// ('outputSize' is the size of the whole serialisation, as returned by 'binarySerialisationSize_(true)')
+void Game::serialiseSeedBased_(unsigned char* const output, const std::size_t outputSize) const {
+
+    if (this->_minesHaveBeenSet && this->_firstCheckedX < 0) {
+        throw std::invalid_argument("Game::serialise(std::ostream& outStream, SerialisationFormat format): "
+                                    "Mines have not been created with a generation seed.");
+    }
+
+    this->serialiseBinaryHeader_(output, BINARY_MAGIC, SEED_BASED_FLAG);
+
+    unsigned char* const fields = output + BINARY_HEADER_SIZE;
+    storeLittleEndian(fields, this->_minesHaveBeenSet ? this->_layoutSeed : 0, 8);
+    storeLittleEndian(fields + 8, this->_minesHaveBeenSet ? static_cast<std::uint32_t>(this->_firstCheckedX)
+                                                          : NO_FIRST_CHECKED_CELL, 4);
+    storeLittleEndian(fields + 12, this->_minesHaveBeenSet ? static_cast<std::uint32_t>(this->_firstCheckedY)
+                                                           : NO_FIRST_CHECKED_CELL, 4);
+    const std::size_t runsSize = outputSize - BINARY_HEADER_SIZE - SEED_BASED_FIELDS_SIZE - BINARY_CHECKSUM_SIZE;
+    storeLittleEndian(fields + 16, static_cast<std::uint32_t>(runsSize), 4);
+    this->serialiseCellStateRuns_(fields + SEED_BASED_FIELDS_SIZE);
+
+    const std::size_t bodySize = SEED_BASED_FIELDS_SIZE + runsSize;
+    storeLittleEndian(fields + bodySize, checksum(fields, bodySize), 8);
+}
+
+std::ostream& Game::serialiseSeedBased_(std::ostream& outStream) const {
+
+    std::vector<unsigned char> output(this->binarySerialisationSize_(true));
+    this->serialiseSeedBased_(output.data(), output.size());
+    outStream.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+    this->countBytesSerialised_(output.size());
+
+    return outStream;
+}
+
+// static method
+bool Game::isBinarySerialisation_(std::istream& inStream) {
+    return inStream.peek() == std::char_traits<char>::to_int_type(static_cast<char>(BINARY_MAGIC[0]));
+}
+
+// static method
+bool Game::isBinarySerialisation_(const unsigned char* const input, const std::size_t inputSize) {
+    return inputSize != 0 && input[0] == BINARY_MAGIC[0];
+}
+
+std::istream& Game::deserialiseBinary_(std::istream& inStream) {
+
+    // header is read first, since it tells the size of the rest
+    std::vector<unsigned char> input(BINARY_HEADER_SIZE);
+    inStream.read(reinterpret_cast<char*>(input.data()), static_cast<std::streamsize>(BINARY_HEADER_SIZE));
+    if (static_cast<std::size_t>(inStream.gcount()) != BINARY_HEADER_SIZE) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+
+    verifyBinaryHeader_(input.data(), BINARY_MAGIC); // throws
+    const auto gridHeight = static_cast<int>(loadLittleEndian(input.data() + 8, 4));
+    const auto gridWidth = static_cast<int>(loadLittleEndian(input.data() + 12, 4));
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(input.data() + 6, 2));
+
+    // (size of seed-based body is only known after reading its fixed size fields)
+    std::size_t bodySize = 0;
+    if ((flags & SEED_BASED_FLAG) != 0) {
+        input.resize(BINARY_HEADER_SIZE + SEED_BASED_FIELDS_SIZE);
+        inStream.read(reinterpret_cast<char*>(input.data() + BINARY_HEADER_SIZE),
+                      static_cast<std::streamsize>(SEED_BASED_FIELDS_SIZE));
+        if (static_cast<std::size_t>(inStream.gcount()) != SEED_BASED_FIELDS_SIZE) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                        "Binary serialisation is truncated.");
+        }
+        bodySize = SEED_BASED_FIELDS_SIZE + loadLittleEndian(input.data() + BINARY_HEADER_SIZE + 16, 4) +
+                   BINARY_CHECKSUM_SIZE;
+    } else {
+        bodySize = binaryBodySize(gridHeight, gridWidth);
+    }
+
+    const std::size_t alreadyRead = input.size() - BINARY_HEADER_SIZE;
+    input.resize(BINARY_HEADER_SIZE + bodySize);
+    inStream.read(reinterpret_cast<char*>(input.data() + BINARY_HEADER_SIZE + alreadyRead),
+                  static_cast<std::streamsize>(bodySize - alreadyRead));
+    if (static_cast<std::size_t>(inStream.gcount()) != bodySize - alreadyRead) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+
+    this->deserialiseBinary_(input.data(), input.size());
+
+    return inStream;
+}
+
+std::size_t Game::deserialiseBinary_(const unsigned char* const input, const std::size_t inputSize) {
+
+    using bitboard::Word;
+
+    if (inputSize < BINARY_HEADER_SIZE) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+
+    // header:
+    verifyBinaryHeader_(input, BINARY_MAGIC); // throws
+    const auto newGridHeight = static_cast<int>(loadLittleEndian(input + 8, 4));
+    const auto newGridWidth = static_cast<int>(loadLittleEndian(input + 12, 4));
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(input + 6, 2));
+    const auto newNumOfMines = static_cast<int>(loadLittleEndian(input + 16, 4));
+    const auto newNumOfMarkedMines = static_cast<int>(loadLittleEndian(input + 20, 4));
+    const auto newNumOfWronglyMarkedCells = static_cast<int>(loadLittleEndian(input + 24, 4));
+    const auto newNumOfVisibleCells = static_cast<int>(loadLittleEndian(input + 28, 4));
+
+    if ((flags & SEED_BASED_FLAG) != 0) {
+        return this->deserialiseSeedBased_(input, inputSize);
+    }
+
+    // body:
+    const std::size_t bitPlanesSize = NUM_OF_BIT_PLANES * bitPlaneSize(newGridHeight, newGridWidth);
+    if (inputSize < BINARY_HEADER_SIZE + bitPlanesSize + BINARY_CHECKSUM_SIZE) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+
+    const unsigned char* const visiblePlane = input + BINARY_HEADER_SIZE;
+    const unsigned char* const minePlane = visiblePlane + bitPlaneSize(newGridHeight, newGridWidth);
+    const unsigned char* const markedPlane = minePlane + bitPlaneSize(newGridHeight, newGridWidth);
+
+    if (checksum(visiblePlane, bitPlanesSize) != loadLittleEndian(visiblePlane + bitPlanesSize, 8)) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                    "Invalid checksum of binary serialisation cells.");
+    }
+
+    // cells are loaded only after whole serialisation has been verified
+    this->_gridHeight = newGridHeight;
+    this->_gridWidth = newGridWidth;
+    this->_numOfMines = newNumOfMines;
+    this->_numOfMarkedMines = newNumOfMarkedMines;
+    this->_numOfWronglyMarkedCells = newNumOfWronglyMarkedCells;
+    this->_numOfVisibleCells = newNumOfVisibleCells;
+    this->_checkedMine = (flags & CHECKED_MINE_FLAG) != 0;
+    this->_minesHaveBeenSet = (flags & MINES_HAVE_BEEN_SET_FLAG) != 0;
+    this->_firstCheckedX = -1;
+    this->_firstCheckedY = -1;
+
+    this->resizeCells_(newGridHeight, newGridWidth);
+
+    const int numOfWords = bitboard::numOfWords(newGridWidth);
+    std::vector<Word> mineBits(static_cast<std::size_t>(newGridHeight) * numOfWords);
+    for (int y = 0; y < newGridHeight; ++y) {
+        Cell* const cellRow = this->mutableCellRow_(y);
+
+        for (int i = 0; i < numOfWords; ++i) {
+            const int firstX = i * bitboard::WORD_BITS;
+            const std::size_t wordIndex = static_cast<std::size_t>(y) * numOfWords + i;
+            const std::size_t offset = wordIndex * sizeof(Word);
+
+            // (bits beyond the grid are ignored)
+            const int numOfCells = std::min(bitboard::WORD_BITS, newGridWidth - firstX);
+            const Word gridBits = numOfCells == bitboard::WORD_BITS ? ~Word{0} : (Word{1} << numOfCells) - 1;
+            mineBits[wordIndex] = loadLittleEndian(minePlane + offset, 8) & gridBits;
+
+            Cell::setFromBitPlanes(&cellRow[firstX], numOfCells, loadLittleEndian(visiblePlane + offset, 8),
+                                   mineBits[wordIndex], loadLittleEndian(markedPlane + offset, 8));
+        }
+    }
+
+    this->createNumsFromMineBits_(mineBits);
+
+    return BINARY_HEADER_SIZE + bitPlanesSize + BINARY_CHECKSUM_SIZE;
+}
+
+std::size_t Game::deserialiseSeedBased_(const unsigned char* const input, const std::size_t inputSize) {
+
+    // (header has already been verified)
+    const auto newGridHeight = static_cast<int>(loadLittleEndian(input + 8, 4));
+    const auto newGridWidth = static_cast<int>(loadLittleEndian(input + 12, 4));
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(input + 6, 2));
+    const bool newMinesHaveBeenSet = (flags & MINES_HAVE_BEEN_SET_FLAG) != 0;
+
+    // body:
+    if (inputSize < BINARY_HEADER_SIZE + SEED_BASED_FIELDS_SIZE) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+    const unsigned char* const fields = input + BINARY_HEADER_SIZE;
+    const std::size_t runsSize = loadLittleEndian(fields + 16, 4);
+    if (inputSize - BINARY_HEADER_SIZE - SEED_BASED_FIELDS_SIZE < runsSize + BINARY_CHECKSUM_SIZE) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Binary serialisation is truncated.");
+    }
+    if (checksum(fields, SEED_BASED_FIELDS_SIZE + runsSize) !=
+        loadLittleEndian(fields + SEED_BASED_FIELDS_SIZE + runsSize, 8)) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                    "Invalid checksum of binary serialisation cells.");
+    }
+
+    const std::uint64_t newLayoutSeed = loadLittleEndian(fields, 8);
+    const auto firstCheckedX = static_cast<std::uint32_t>(loadLittleEndian(fields + 8, 4));
+    const auto firstCheckedY = static_cast<std::uint32_t>(loadLittleEndian(fields + 12, 4));
+    if (newMinesHaveBeenSet ? firstCheckedX >= static_cast<std::uint32_t>(newGridWidth) ||
+                                  firstCheckedY >= static_cast<std::uint32_t>(newGridHeight)
+                            : firstCheckedX != NO_FIRST_CHECKED_CELL || firstCheckedY != NO_FIRST_CHECKED_CELL) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                    "Invalid first checked cell of seed-based serialisation.");
+    }
+
+    // runs are decoded before any fields are changed
+    const std::size_t numOfCells = static_cast<std::size_t>(newGridHeight) * newGridWidth;
+    std::vector<unsigned char> cellStates(numOfCells);
+    std::size_t numOfDecodedCells = 0;
+    const unsigned char* run = fields + SEED_BASED_FIELDS_SIZE;
+    const unsigned char* const runsEnd = run + runsSize;
+    while (run != runsEnd) {
+        std::uint64_t value = 0;
+        if (!readVarint(run, runsEnd, value) || (value & 0x3U) == (VISIBLE_STATE | MARKED_STATE) ||
+            (value >> 2U) >= numOfCells - numOfDecodedCells) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                        "Invalid cell runs of seed-based serialisation.");
+        }
+        const std::size_t runLength = (value >> 2U) + 1;
+        std::fill_n(cellStates.begin() + static_cast<std::ptrdiff_t>(numOfDecodedCells), runLength,
+                    static_cast<unsigned char>(value & 0x3U));
+        numOfDecodedCells += runLength;
+    }
+    if (numOfDecodedCells != numOfCells) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                    "Invalid cell runs of seed-based serialisation.");
+    }
+
+    // mines are recreated exactly like when the first cell was checked
+    this->_gridHeight = newGridHeight;
+    this->_gridWidth = newGridWidth;
+    this->_numOfMines = static_cast<int>(loadLittleEndian(input + 16, 4));
+    this->_checkedMine = (flags & CHECKED_MINE_FLAG) != 0;
+    this->_minesHaveBeenSet = false;
+    this->_firstCheckedX = -1;
+    this->_firstCheckedY = -1;
+
+    this->resizeCells_(newGridHeight, newGridWidth);
+
+    if (newMinesHaveBeenSet) {
+        FastRandom seededRandom(newLayoutSeed);
+        this->createMinesAndNums_(static_cast<int>(firstCheckedX), static_cast<int>(firstCheckedY), seededRandom);
+        this->_layoutSeed = newLayoutSeed;
+        this->_firstCheckedX = static_cast<int>(firstCheckedX);
+        this->_firstCheckedY = static_cast<int>(firstCheckedY);
+    }
+
+    for (int y = 0; y < newGridHeight; ++y) {
+        Cell* const cellRow = this->mutableCellRow_(y);
+        const unsigned char* const stateRow = &cellStates[static_cast<std::size_t>(y) * newGridWidth];
+
+        for (int x = 0; x < newGridWidth; ++x) {
+            if ((stateRow[x] & VISIBLE_STATE) != 0) {
+                cellRow[x].makeVisible();
+            }
+            if ((stateRow[x] & MARKED_STATE) != 0) {
+                cellRow[x].markCell();
+            }
+        }
+    }
+
+    // (counters are taken from the header, like in bit plane serialisations)
+    this->_numOfMarkedMines = static_cast<int>(loadLittleEndian(input + 20, 4));
+    this->_numOfWronglyMarkedCells = static_cast<int>(loadLittleEndian(input + 24, 4));
+    this->_numOfVisibleCells = static_cast<int>(loadLittleEndian(input + 28, 4));
+
+    return BINARY_HEADER_SIZE + SEED_BASED_FIELDS_SIZE + runsSize + BINARY_CHECKSUM_SIZE;
+}
+
+std::ostream& Game::serialiseDelta(std::ostream& outStream) const {
+
+    using bitboard::Word;
+
+    // (every row is included, if the whole grid has changed since the checkpoint)
+    const bool isFullDelta = this->_gridChanged;
+    std::vector<int> rows;
+    if (isFullDelta) {
+        for (int y = 0; y < this->_gridHeight; ++y) {
+            rows.push_back(y);
+        }
+    } else {
+        for (std::size_t i = 0; i < this->_changedRows.size(); ++i) {
+            for (Word rowBits = this->_changedRows[i]; rowBits != 0; rowBits &= rowBits - 1) {
+                rows.push_back(static_cast<int>(i) * bitboard::WORD_BITS + bitboard::countTrailingZeros(rowBits));
+            }
+        }
+    }
+
+    const std::size_t rowSize = deltaRowSize(this->_gridWidth, isFullDelta);
+    const std::size_t bodySize = DELTA_FIELDS_SIZE + rows.size() * rowSize;
+    std::vector<unsigned char> output(BINARY_HEADER_SIZE + bodySize + BINARY_CHECKSUM_SIZE);
+    this->serialiseBinaryHeader_(output.data(), DELTA_MAGIC, isFullDelta ? FULL_DELTA_FLAG : 0);
+
+    unsigned char* const body = output.data() + BINARY_HEADER_SIZE;
+    storeLittleEndian(body, static_cast<std::uint32_t>(rows.size()), 4);
+
+    const int numOfWords = bitboard::numOfWords(this->_gridWidth);
+    unsigned char* rowOutput = body + DELTA_FIELDS_SIZE;
+    for (const int y : rows) {
+        const Cell* const cellRow = this->cellRow_(y);
+        storeLittleEndian(rowOutput, static_cast<std::uint32_t>(y), 4);
+
+        unsigned char* const visibleWords = rowOutput + 4;
+        unsigned char* const markedWords = visibleWords + numOfWords * sizeof(Word);
+        unsigned char* const mineWords = markedWords + numOfWords * sizeof(Word);
+        for (int i = 0; i < numOfWords; ++i) {
+            const int firstX = i * bitboard::WORD_BITS;
+            Word visibleBits = 0;
+            Word mineBits = 0;
+            Word markedBits = 0;
+            Cell::bitPlanes(&cellRow[firstX], std::min(bitboard::WORD_BITS, this->_gridWidth - firstX), visibleBits,
+                            mineBits, markedBits);
+
+            storeLittleEndian(visibleWords + i * sizeof(Word), visibleBits, 8);
+            storeLittleEndian(markedWords + i * sizeof(Word), markedBits, 8);
+            if (isFullDelta) {
+                storeLittleEndian(mineWords + i * sizeof(Word), mineBits, 8);
+            }
+        }
+        rowOutput += rowSize;
+    }
+    storeLittleEndian(body + bodySize, checksum(body, bodySize), 8);
+
+    outStream.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+    this->countBytesSerialised_(output.size());
+
+    return outStream;
+}
+
+std::istream& Game::applyDelta(std::istream& inStream) {
+
+    // header and number of rows are read first, since they tell the size of the rest
+    std::vector<unsigned char> input(BINARY_HEADER_SIZE + DELTA_FIELDS_SIZE);
+    inStream.read(reinterpret_cast<char*>(input.data()), static_cast<std::streamsize>(input.size()));
+    if (static_cast<std::size_t>(inStream.gcount()) != input.size()) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta is truncated.");
+    }
+
+    verifyBinaryHeader_(input.data(), DELTA_MAGIC); // throws
+    const auto gridHeight = static_cast<int>(loadLittleEndian(input.data() + 8, 4));
+    const auto gridWidth = static_cast<int>(loadLittleEndian(input.data() + 12, 4));
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(input.data() + 6, 2));
+    const std::uint64_t numOfRows = loadLittleEndian(input.data() + BINARY_HEADER_SIZE, 4);
+    if (numOfRows > static_cast<std::uint64_t>(gridHeight)) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta has too many rows.");
+    }
+
+    const std::size_t restSize = numOfRows * deltaRowSize(gridWidth, (flags & FULL_DELTA_FLAG) != 0) +
+                                 BINARY_CHECKSUM_SIZE;
+    input.resize(input.size() + restSize);
+    inStream.read(reinterpret_cast<char*>(input.data() + BINARY_HEADER_SIZE + DELTA_FIELDS_SIZE),
+                  static_cast<std::streamsize>(restSize));
+    if (static_cast<std::size_t>(inStream.gcount()) != restSize) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta is truncated.");
+    }
+
+    this->applyDelta_(input.data(), input.size());
+
+    return inStream;
+}
+
+std::size_t Game::applyDelta_(const unsigned char* const input, const std::size_t inputSize) {
+
+    using bitboard::Word;
+
+    if (inputSize < BINARY_HEADER_SIZE + DELTA_FIELDS_SIZE) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta is truncated.");
+    }
+
+    // header:
+    verifyBinaryHeader_(input, DELTA_MAGIC); // throws
+    const auto newGridHeight = static_cast<int>(loadLittleEndian(input + 8, 4));
+    const auto newGridWidth = static_cast<int>(loadLittleEndian(input + 12, 4));
+    const auto flags = static_cast<std::uint16_t>(loadLittleEndian(input + 6, 2));
+    const auto newNumOfMines = static_cast<int>(loadLittleEndian(input + 16, 4));
+    const bool isFullDelta = (flags & FULL_DELTA_FLAG) != 0;
+    const bool newMinesHaveBeenSet = (flags & MINES_HAVE_BEEN_SET_FLAG) != 0;
+
+    // (only full deltas can change grid or mines)
+    if (!isFullDelta && (newGridHeight != this->_gridHeight || newGridWidth != this->_gridWidth ||
+                         newNumOfMines != this->_numOfMines || newMinesHaveBeenSet != this->_minesHaveBeenSet)) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta does not apply to this game.");
+    }
+
+    // body:
+    const unsigned char* const body = input + BINARY_HEADER_SIZE;
+    const std::uint64_t numOfRows = loadLittleEndian(body, 4);
+    if (numOfRows > static_cast<std::uint64_t>(newGridHeight) ||
+        (isFullDelta && numOfRows != static_cast<std::uint64_t>(newGridHeight))) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta has invalid number of rows.");
+    }
+
+    const std::size_t rowSize = deltaRowSize(newGridWidth, isFullDelta);
+    const std::size_t bodySize = DELTA_FIELDS_SIZE + numOfRows * rowSize;
+    if (inputSize - BINARY_HEADER_SIZE < bodySize + BINARY_CHECKSUM_SIZE) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta is truncated.");
+    }
+    if (checksum(body, bodySize) != loadLittleEndian(body + bodySize, 8)) {
+        throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Invalid checksum of delta rows.");
+    }
+
+    const int numOfWords = bitboard::numOfWords(newGridWidth);
+    auto wordOf = [rowSize, numOfWords, body](const std::size_t row, const int plane, const int i) {
+        return loadLittleEndian(body + DELTA_FIELDS_SIZE + row * rowSize + 4 +
+                                    (static_cast<std::size_t>(plane) * numOfWords + i) * sizeof(Word),
+                                8);
+    };
+    const int VISIBLE_PLANE = 0;
+    const int MARKED_PLANE = 1;
+    const int MINE_PLANE = 2;
+
+    // rows are verified before any fields are changed
+    // (visible cells never become hidden, except when the whole grid changes, which only full deltas do)
+    int previousRow = -1;
+    for (std::size_t row = 0; row < numOfRows; ++row) {
+        const std::uint64_t y = loadLittleEndian(body + DELTA_FIELDS_SIZE + row * rowSize, 4);
+        if (y >= static_cast<std::uint64_t>(newGridHeight) || static_cast<int>(y) <= previousRow) {
+            throw std::invalid_argument("Game::applyDelta(std::istream& inStream): Delta has invalid row numbers.");
+        }
+        previousRow = static_cast<int>(y);
+
+        if (!isFullDelta) {
+            const Cell* const cellRow = this->cellRow_(previousRow);
+            for (int i = 0; i < numOfWords; ++i) {
+                const int firstX = i * bitboard::WORD_BITS;
+                Word visibleBits = 0;
+                Word mineBits = 0;
+                Word markedBits = 0;
+                Cell::bitPlanes(&cellRow[firstX], std::min(bitboard::WORD_BITS, newGridWidth - firstX), visibleBits,
+                                mineBits, markedBits);
+                if ((visibleBits & ~wordOf(row, VISIBLE_PLANE, i)) != 0) {
+                    throw std::invalid_argument(
+                        "Game::applyDelta(std::istream& inStream): Delta does not apply to this game.");
+                }
+            }
+        }
+    }
+
+    // cells are changed only after whole delta has been verified
+    this->_numOfMarkedMines = static_cast<int>(loadLittleEndian(input + 20, 4));
+    this->_numOfWronglyMarkedCells = static_cast<int>(loadLittleEndian(input + 24, 4));
+    this->_numOfVisibleCells = static_cast<int>(loadLittleEndian(input + 28, 4));
+    this->_checkedMine = (flags & CHECKED_MINE_FLAG) != 0;
+
+    if (isFullDelta) {
+        this->_gridHeight = newGridHeight;
+        this->_gridWidth = newGridWidth;
+        this->_numOfMines = newNumOfMines;
+        this->_minesHaveBeenSet = newMinesHaveBeenSet;
+        this->_firstCheckedX = -1;
+        this->_firstCheckedY = -1;
+
+        this->resizeCells_(newGridHeight, newGridWidth);
+
+        std::vector<Word> mineBits(static_cast<std::size_t>(newGridHeight) * numOfWords);
+        for (int y = 0; y < newGridHeight; ++y) {
+            Cell* const cellRow = this->mutableCellRow_(y);
+            const auto row = static_cast<std::size_t>(y);
+
+            for (int i = 0; i < numOfWords; ++i) {
+                const int firstX = i * bitboard::WORD_BITS;
+                const std::size_t wordIndex = row * numOfWords + i;
+
+                // (bits beyond the grid are ignored)
+                const int numOfCells = std::min(bitboard::WORD_BITS, newGridWidth - firstX);
+                const Word gridBits = numOfCells == bitboard::WORD_BITS ? ~Word{0} : (Word{1} << numOfCells) - 1;
+                mineBits[wordIndex] = wordOf(row, MINE_PLANE, i) & gridBits;
+
+                Cell::setFromBitPlanes(&cellRow[firstX], numOfCells, wordOf(row, VISIBLE_PLANE, i), mineBits[wordIndex],
+                                       wordOf(row, MARKED_PLANE, i));
+            }
+        }
+
+        this->createNumsFromMineBits_(mineBits);
+    } else {
+        // (journalled moves would not match the cells anymore)
+        this->clearMoveJournal_();
+
+        for (std::size_t row = 0; row < numOfRows; ++row) {
+            const auto y = static_cast<int>(loadLittleEndian(body + DELTA_FIELDS_SIZE + row * rowSize, 4));
+            Cell* const cellRow = this->mutableCellRow_(y);
+
+            for (int i = 0; i < numOfWords; ++i) {
+                const int firstX = i * bitboard::WORD_BITS;
+                const int numOfCells = std::min(bitboard::WORD_BITS, newGridWidth - firstX);
+                const Word gridBits = numOfCells == bitboard::WORD_BITS ? ~Word{0} : (Word{1} << numOfCells) - 1;
+                Word visibleBits = 0;
+                Word mineBits = 0;
+                Word markedBits = 0;
+                Cell::bitPlanes(&cellRow[firstX], numOfCells, visibleBits, mineBits, markedBits);
+
+                // only changed cells are changed, so that mines and numbers of mines around are kept
+                for (Word revealedBits = wordOf(row, VISIBLE_PLANE, i) & ~visibleBits & gridBits; revealedBits != 0;
+                     revealedBits &= revealedBits - 1) {
+                    cellRow[firstX + bitboard::countTrailingZeros(revealedBits)].makeVisible();
+                }
+                for (Word toggledBits = (wordOf(row, MARKED_PLANE, i) ^ markedBits) & gridBits; toggledBits != 0;
+                     toggledBits &= toggledBits - 1) {
+                    Cell& cell = cellRow[firstX + bitboard::countTrailingZeros(toggledBits)];
+                    if (cell.isMarked()) {
+                        cell.unmarkCell();
+                    } else {
+                        cell.markCell();
+                    }
+                }
+            }
+            this->markRowChanged_(this->cellIndex_(0, y));
+        }
+    }
+
+    return BINARY_HEADER_SIZE + bodySize + BINARY_CHECKSUM_SIZE;
+}
+
+// static method
+void Game::verifyBinaryHeader_(const unsigned char* const header, const unsigned char* const magic) {
+
+    for (int i = 0; i < 4; ++i) {
+        if (header[i] != magic[i]) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid binary magic.");
+        }
+    }
+
+    if (checksum(header, BINARY_HEADER_CHECKSUM_OFFSET) !=
+        loadLittleEndian(header + BINARY_HEADER_CHECKSUM_OFFSET, 8)) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): "
+                                    "Invalid checksum of binary serialisation header.");
+    }
+
+    const auto version = static_cast<std::uint16_t>(loadLittleEndian(header + 4, 2));
+    if (version != BINARY_VERSION) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid binary version number: " +
+                                    std::to_string(version));
+    }
+
+    const std::uint64_t gridHeight = loadLittleEndian(header + 8, 4);
+    const std::uint64_t gridWidth = loadLittleEndian(header + 12, 4);
+    if (gridHeight * gridWidth > INT_MAX) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Grid of binary serialisation "
+                                    "has too many cells.");
+    }
+
+    // counters are verified like in JSON serialisations
+    const int newGridHeight = verifyGridDimension_(static_cast<int>(gridHeight));
+    const int newGridWidth = verifyGridDimension_(static_cast<int>(gridWidth));
+    const int newNumOfMines =
+        verifyNumOfMines_(static_cast<int>(loadLittleEndian(header + 16, 4)), newGridHeight, newGridWidth);
+    verifyNumOfMarkedMines_(static_cast<int>(loadLittleEndian(header + 20, 4)), newNumOfMines);
+    verifyNumOfWronglyMarkedCells_(static_cast<int>(loadLittleEndian(header + 24, 4)), newGridHeight, newGridWidth,
+                                   newNumOfMines);
+    verifyNumOfVisibleCells_(static_cast<int>(loadLittleEndian(header + 28, 4)), newGridHeight, newGridWidth);
+}
+
+} // namespace minesweeper
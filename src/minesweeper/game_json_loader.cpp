@@ -0,0 +1,433 @@
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <initializer_list> // std::initializer_list
+#include <stdexcept>        // std::invalid_argument
+#include <string>           // std::string
+
+#include <json.hpp> // nlohmann::json
+
+#include <minesweeper/cell.h>
+#include <minesweeper/game.h>
+#include <minesweeper/game_json_loader.h>
+
+namespace minesweeper {
+
+bool Game::JsonLoader::null() {
+    this->value_(ValueType::OTHER, 0);
+    return true;
+}
+
+bool Game::JsonLoader::boolean(const bool val) {
+    this->value_(ValueType::BOOLEAN, val ? 1 : 0);
+    return true;
+}
+
+bool Game::JsonLoader::number_integer(const number_integer_t val) {
+    this->value_(ValueType::INTEGER, static_cast<int>(val));
+    return true;
+}
+
+bool Game::JsonLoader::number_unsigned(const number_unsigned_t val) {
+    this->value_(ValueType::INTEGER, static_cast<int>(val));
+    return true;
+}
+
+bool Game::JsonLoader::number_float(const number_float_t val, const string_t& /*s*/) {
+    this->value_(ValueType::INTEGER, static_cast<int>(val));
+    return true;
+}
+
+bool Game::JsonLoader::string(string_t& val) {
+
+    // current serialisation magic and version:
+    const std::string CURRENT_SERIALISATION_MAGIC = "Timi's Minesweeper";
+    const std::string CURRENT_SERIALISATION_VERSION = "1.0";
+
+    // (magic and version are verified as soon as they are read)
+    switch (this->value_(ValueType::STRING, 0)) {
+    case Field::MAGIC:
+        if (val != CURRENT_SERIALISATION_MAGIC) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid magic: " + val);
+        }
+        break;
+    case Field::VERSION:
+        if (val != CURRENT_SERIALISATION_VERSION) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Invalid version number: " + val);
+        }
+        break;
+    case Field::CELL_VERSION:
+        this->_cellVersion = val;
+        break;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+bool Game::JsonLoader::start_object(std::size_t /*elements*/) {
+
+    if (this->_contexts.empty()) {
+        this->_contexts.push_back(Context::ROOT);
+        return true;
+    }
+
+    const Context parentContext = this->_contexts.back();
+    const Field field = this->value_(ValueType::OBJECT, 0);
+
+    if (parentContext == Context::CELLS) {
+        this->_contexts.push_back(Context::ROW);
+        this->forget_({Field::ROW_CELLS, Field::ROW_NUMBER});
+    } else if (parentContext == Context::ROW_CELLS) {
+        this->_contexts.push_back(Context::CELL_ENTRY);
+        this->forget_({Field::CELL, Field::COLUMN_NUMBER});
+    } else if (field == Field::CURRENT_GAME) {
+        this->_contexts.push_back(Context::CURRENT_GAME);
+    } else if (field == Field::CELL) {
+        this->_contexts.push_back(Context::CELL);
+        this->forget_({Field::CELL_VERSION, Field::IS_VISIBLE, Field::HAS_MINE, Field::IS_MARKED,
+                       Field::NUM_OF_MINES_AROUND});
+        this->_cellVersion.clear();
+    } else {
+        this->_contexts.push_back(Context::IGNORED);
+    }
+
+    return true;
+}
+
+bool Game::JsonLoader::key(string_t& val) {
+    this->_field = this->field_(val);
+    return true;
+}
+
+bool Game::JsonLoader::end_object() {
+
+    switch (this->_contexts.back()) {
+    case Context::ROOT:
+        this->requireFields_({Field::MAGIC, Field::VERSION, Field::CURRENT_GAME});
+        break;
+    case Context::CURRENT_GAME:
+        this->endCurrentGame_();
+        break;
+    case Context::ROW:
+        this->endRow_();
+        break;
+    case Context::CELL_ENTRY:
+        this->endCellEntry_();
+        break;
+    case Context::CELL:
+        this->endCell_();
+        break;
+    default:
+        break;
+    }
+
+    this->_contexts.pop_back();
+    this->_field = Field::NONE;
+    return true;
+}
+
+bool Game::JsonLoader::start_array(std::size_t /*elements*/) {
+
+    if (this->_contexts.empty()) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument is not a JSON object.");
+    }
+
+    const Context parentContext = this->_contexts.back();
+    const Field field = this->value_(ValueType::ARRAY, 0);
+
+    if (parentContext != Context::IGNORED && field == Field::CELLS) {
+        this->_contexts.push_back(Context::CELLS);
+    } else if (parentContext != Context::IGNORED && field == Field::ROW_CELLS) {
+        this->_contexts.push_back(Context::ROW_CELLS);
+        this->_firstCellOfRow = this->_loadedCells.size();
+    } else {
+        this->_contexts.push_back(Context::IGNORED);
+    }
+
+    return true;
+}
+
+bool Game::JsonLoader::end_array() {
+    this->_contexts.pop_back();
+    this->_field = Field::NONE;
+    return true;
+}
+
+bool Game::JsonLoader::parse_error(std::size_t /*position*/, const std::string& /*lastToken*/,
+                                   const nlohmann::detail::exception& ex) {
+    throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument is not valid JSON.\n\t" +
+                                std::string(ex.what()));
+}
+
+void Game::JsonLoader::load(Game& game) {
+
+    const int newGridHeight = this->valueOf_(Field::GRID_HEIGHT);
+    const int newGridWidth = this->valueOf_(Field::GRID_WIDTH);
+
+    // cells are verified before anything is assigned, so that 'game' is left untouched if they are invalid
+    if (newGridHeight != 0 && newGridWidth != 0) {
+        for (const LoadedCell& loadedCell : this->_loadedCells) {
+            if (loadedCell.x < 0 || loadedCell.y < 0 || loadedCell.x >= newGridWidth ||
+                loadedCell.y >= newGridHeight) {
+                throw std::invalid_argument("Game::deserialise(std::istream& inStream): Cell (" +
+                                            std::to_string(loadedCell.x) + ", " + std::to_string(loadedCell.y) +
+                                            ") is outside the grid.");
+            }
+        }
+    }
+
+    game._gridHeight = newGridHeight;
+    game._gridWidth = newGridWidth;
+    game._numOfMines = this->valueOf_(Field::NUM_OF_MINES);
+    game._numOfMarkedMines = this->valueOf_(Field::NUM_OF_MARKED_MINES);
+    game._numOfWronglyMarkedCells = this->valueOf_(Field::NUM_OF_WRONGLY_MARKED_CELLS);
+    game._numOfVisibleCells = this->valueOf_(Field::NUM_OF_VISIBLE_CELLS);
+    game._checkedMine = this->valueOf_(Field::CHECKED_MINE) != 0;
+    game._minesHaveBeenSet = this->valueOf_(Field::MINES_HAVE_BEEN_SET) != 0;
+    game._firstCheckedX = -1;
+    game._firstCheckedY = -1;
+
+    // resize cells/grid to accept their data
+    game.resizeCells_(newGridHeight, newGridWidth);
+
+    // cell data:
+    if (newGridHeight != 0 && newGridWidth != 0) {
+        for (const LoadedCell& loadedCell : this->_loadedCells) {
+            game.mutableCellAt_(loadedCell.x, loadedCell.y) = loadedCell.cell;
+        }
+    }
+}
+
+Game::JsonLoader::Field Game::JsonLoader::value_(const ValueType type, const int value) {
+
+    if (this->_contexts.empty()) {
+        throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument is not a JSON object.");
+    }
+
+    switch (this->_contexts.back()) {
+    case Context::IGNORED:
+        return Field::NONE;
+    case Context::CELLS:
+    case Context::ROW_CELLS:
+        // (elements of these arrays are rows and cells)
+        if (type != ValueType::OBJECT) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument has an array element "
+                                        "of wrong type.");
+        }
+        return Field::NONE;
+    default:
+        break;
+    }
+
+    const Field field = this->_field;
+    this->_field = Field::NONE;
+
+    if (field != Field::NONE) {
+        if (type != typeOf_(field)) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument has a value of "
+                                        "wrong type: " +
+                                        std::string(keyOf_(field)));
+        }
+
+        this->_readFields |= std::uint32_t{1} << static_cast<int>(field);
+        this->_values[static_cast<int>(field)] = value;
+    }
+
+    return field;
+}
+
+void Game::JsonLoader::endCurrentGame_() {
+
+    this->requireFields_({Field::GRID_HEIGHT, Field::GRID_WIDTH, Field::NUM_OF_MINES, Field::NUM_OF_MARKED_MINES,
+                          Field::NUM_OF_WRONGLY_MARKED_CELLS, Field::NUM_OF_VISIBLE_CELLS, Field::CHECKED_MINE,
+                          Field::MINES_HAVE_BEEN_SET});
+
+    // current game fields are verified as soon as they have been read:
+    const int newGridHeight = verifyGridDimension_(this->valueOf_(Field::GRID_HEIGHT));
+    const int newGridWidth = verifyGridDimension_(this->valueOf_(Field::GRID_WIDTH));
+    const int newNumOfMines = verifyNumOfMines_(this->valueOf_(Field::NUM_OF_MINES), newGridHeight, newGridWidth);
+    verifyNumOfMarkedMines_(this->valueOf_(Field::NUM_OF_MARKED_MINES), newNumOfMines);
+    verifyNumOfWronglyMarkedCells_(this->valueOf_(Field::NUM_OF_WRONGLY_MARKED_CELLS), newGridHeight, newGridWidth,
+                                   newNumOfMines);
+    verifyNumOfVisibleCells_(this->valueOf_(Field::NUM_OF_VISIBLE_CELLS), newGridHeight, newGridWidth);
+
+    if (newGridHeight != 0 && newGridWidth != 0) {
+        this->requireFields_({Field::CELLS});
+    }
+}
+
+void Game::JsonLoader::endRow_() {
+
+    this->requireFields_({Field::ROW_CELLS, Field::ROW_NUMBER});
+
+    // (row number comes after cells of the row)
+    for (std::size_t i = this->_firstCellOfRow; i < this->_loadedCells.size(); ++i) {
+        this->_loadedCells[i].y = this->valueOf_(Field::ROW_NUMBER);
+    }
+}
+
+void Game::JsonLoader::endCellEntry_() {
+
+    this->requireFields_({Field::CELL, Field::COLUMN_NUMBER});
+
+    this->_loadedCells.push_back(LoadedCell{this->valueOf_(Field::COLUMN_NUMBER), -1, this->_loadedCell});
+}
+
+void Game::JsonLoader::endCell_() {
+
+    // current serialisation keys:
+    const std::string CURRENT_CELL_VERSION = "1.0";
+
+    this->requireFields_({Field::CELL_VERSION});
+
+    // cells of other versions are left empty
+    this->_loadedCell = Cell();
+    if (this->_cellVersion == CURRENT_CELL_VERSION) {
+        this->requireFields_({Field::IS_VISIBLE, Field::HAS_MINE, Field::IS_MARKED, Field::NUM_OF_MINES_AROUND});
+
+        this->_loadedCell.deserialise(this->valueOf_(Field::IS_VISIBLE) != 0, this->valueOf_(Field::HAS_MINE) != 0,
+                                      this->valueOf_(Field::IS_MARKED) != 0,
+                                      this->valueOf_(Field::NUM_OF_MINES_AROUND)); // throws
+    }
+}
+
+Game::JsonLoader::Field Game::JsonLoader::field_(const string_t& key) const {
+
+    // fields of each context are consecutive 'Field' values
+    Field firstField = Field::NONE;
+    Field lastField = Field::NONE;
+    switch (this->_contexts.back()) {
+    case Context::ROOT:
+        firstField = Field::MAGIC;
+        lastField = Field::CURRENT_GAME;
+        break;
+    case Context::CURRENT_GAME:
+        firstField = Field::GRID_HEIGHT;
+        lastField = Field::CELLS;
+        break;
+    case Context::ROW:
+        firstField = Field::ROW_CELLS;
+        lastField = Field::ROW_NUMBER;
+        break;
+    case Context::CELL_ENTRY:
+        firstField = Field::CELL;
+        lastField = Field::COLUMN_NUMBER;
+        break;
+    case Context::CELL:
+        firstField = Field::CELL_VERSION;
+        lastField = Field::NUM_OF_MINES_AROUND;
+        break;
+    default:
+        return Field::NONE;
+    }
+
+    for (int field = static_cast<int>(firstField); field <= static_cast<int>(lastField); ++field) {
+        if (key == keyOf_(static_cast<Field>(field))) {
+            return static_cast<Field>(field);
+        }
+    }
+
+    // unknown keys are ignored
+    return Field::NONE;
+}
+
+void Game::JsonLoader::requireFields_(const std::initializer_list<Field> fields) const {
+
+    for (const Field field : fields) {
+        if (!this->hasRead_(field)) {
+            throw std::invalid_argument("Game::deserialise(std::istream& inStream): Argument key does not exist: " +
+                                        std::string(keyOf_(field)));
+        }
+    }
+}
+
+bool Game::JsonLoader::hasRead_(const Field field) const {
+    return (this->_readFields & (std::uint32_t{1} << static_cast<int>(field))) != 0;
+}
+
+void Game::JsonLoader::forget_(const std::initializer_list<Field> fields) {
+    for (const Field field : fields) {
+        this->_readFields &= ~(std::uint32_t{1} << static_cast<int>(field));
+    }
+}
+
+int Game::JsonLoader::valueOf_(const Field field) const { return this->_values[static_cast<int>(field)]; }
+
+// static method
+Game::JsonLoader::ValueType Game::JsonLoader::typeOf_(const Field field) {
+
+    switch (field) {
+    case Field::CURRENT_GAME:
+    case Field::CELL:
+        return ValueType::OBJECT;
+    case Field::CELLS:
+    case Field::ROW_CELLS:
+        return ValueType::ARRAY;
+    case Field::MAGIC:
+    case Field::VERSION:
+    case Field::CELL_VERSION:
+        return ValueType::STRING;
+    case Field::CHECKED_MINE:
+    case Field::MINES_HAVE_BEEN_SET:
+    case Field::IS_VISIBLE:
+    case Field::HAS_MINE:
+    case Field::IS_MARKED:
+        return ValueType::BOOLEAN;
+    default:
+        return ValueType::INTEGER;
+    }
+}
+
+// static method
+const char* Game::JsonLoader::keyOf_(const Field field) {
+
+    switch (field) {
+    case Field::MAGIC:
+        return MAGIC_KEY;
+    case Field::VERSION:
+        return VERSION_KEY;
+    case Field::CURRENT_GAME:
+        return CURRENT_GAME_KEY;
+    case Field::GRID_HEIGHT:
+        return GRID_HEIGHT_KEY;
+    case Field::GRID_WIDTH:
+        return GRID_WIDTH_KEY;
+    case Field::NUM_OF_MINES:
+        return NUM_OF_MINES_KEY;
+    case Field::NUM_OF_MARKED_MINES:
+        return NUM_OF_MARKED_MINES_KEY;
+    case Field::NUM_OF_WRONGLY_MARKED_CELLS:
+        return NUM_OF_WRONGLY_MARKED_CELLS_KEY;
+    case Field::NUM_OF_VISIBLE_CELLS:
+        return NUM_OF_VISIBLE_CELLS_KEY;
+    case Field::CHECKED_MINE:
+        return CHECKED_MINE_KEY;
+    case Field::MINES_HAVE_BEEN_SET:
+        return MINES_HAVE_BEEN_SET_KEY;
+    case Field::CELLS:
+        return CELLS_KEY;
+    case Field::ROW_CELLS:
+        return ROW_CELLS_KEY;
+    case Field::ROW_NUMBER:
+        return ROW_NUMBER_KEY;
+    case Field::CELL:
+        return CELL_KEY;
+    case Field::COLUMN_NUMBER:
+        return COLUMN_NUMBER_KEY;
+    case Field::CELL_VERSION:
+        return Cell::CELL_VERSION_KEY;
+    case Field::IS_VISIBLE:
+        return Cell::IS_VISIBLE_KEY;
+    case Field::HAS_MINE:
+        return Cell::HAS_MINE_KEY;
+    case Field::IS_MARKED:
+        return Cell::IS_MARKED_KEY;
+    case Field::NUM_OF_MINES_AROUND:
+        return Cell::NUM_OF_MINES_AROUND_KEY;
+    default:
+        return "";
+    }
+}
+
+} // namespace minesweeper
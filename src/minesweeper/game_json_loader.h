@@ -0,0 +1,146 @@
+#ifndef MINESWEEPER_GAME_JSON_LOADER_H
+#define MINESWEEPER_GAME_JSON_LOADER_H
+
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <initializer_list> // std::initializer_list
+#include <string>           // std::string
+#include <vector>           // std::vector
+
+#include <json.hpp> // nlohmann::json
+
+#include <minesweeper/cell.h>
+#include <minesweeper/game.h>
+
+namespace minesweeper {
+
+// SAX handler for 'nlohmann::json::sax_parse', which loads version 1.0 serialisations of 'Game' as tokens arrive,
+// instead of building a 'nlohmann::json' document of the whole serialisation first
+// (keys are sorted in version 1.0 serialisations, hence cells arrive before grid dimensions
+// and are kept compactly until the whole game has been read)
+class Game::JsonLoader {
+  public:
+    // types of 'nlohmann::json' SAX interface:
+    using number_integer_t = nlohmann::json::number_integer_t;
+    using number_unsigned_t = nlohmann::json::number_unsigned_t;
+    using number_float_t = nlohmann::json::number_float_t;
+    using string_t = nlohmann::json::string_t;
+
+  private:
+    // +--------+
+    // | types: |
+    // +--------+
+
+    // objects and arrays of a serialisation
+    enum class Context { ROOT, CURRENT_GAME, CELLS, ROW, ROW_CELLS, CELL_ENTRY, CELL, IGNORED };
+
+    // known keys of a serialisation (value of 'NONE' is ignored)
+    enum class Field {
+        NONE,
+        MAGIC,
+        VERSION,
+        CURRENT_GAME,
+        GRID_HEIGHT,
+        GRID_WIDTH,
+        NUM_OF_MINES,
+        NUM_OF_MARKED_MINES,
+        NUM_OF_WRONGLY_MARKED_CELLS,
+        NUM_OF_VISIBLE_CELLS,
+        CHECKED_MINE,
+        MINES_HAVE_BEEN_SET,
+        CELLS,
+        ROW_CELLS,
+        ROW_NUMBER,
+        CELL,
+        COLUMN_NUMBER,
+        CELL_VERSION,
+        IS_VISIBLE,
+        HAS_MINE,
+        IS_MARKED,
+        NUM_OF_MINES_AROUND,
+        NUM_OF_FIELDS
+    };
+
+    // types of values (null and binary values are 'OTHER')
+    enum class ValueType { OBJECT, ARRAY, INTEGER, BOOLEAN, STRING, OTHER };
+
+    // cell read from a serialisation (with its coordinates)
+    struct LoadedCell {
+        int x;
+        int y;
+        Cell cell;
+    };
+
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    std::vector<Context> _contexts;
+    Field _field = Field::NONE;
+
+    // fields read so far (bit per 'Field')
+    std::uint32_t _readFields = 0;
+    int _values[static_cast<int>(Field::NUM_OF_FIELDS)] = {};
+    std::string _cellVersion;
+
+    std::vector<LoadedCell> _loadedCells;
+    std::size_t _firstCellOfRow = 0;
+    Cell _loadedCell;
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // 'nlohmann::json' SAX interface methods:
+    bool null();
+    bool boolean(bool val);
+    bool number_integer(number_integer_t val);
+    bool number_unsigned(number_unsigned_t val);
+    bool number_float(number_float_t val, const string_t& s);
+    bool string(string_t& val);
+    template <class BinaryType>
+    bool binary(BinaryType& val);
+    bool start_object(std::size_t elements);
+    bool key(string_t& val);
+    bool end_object();
+    bool start_array(std::size_t elements);
+    bool end_array();
+    bool parse_error(std::size_t position, const std::string& lastToken, const nlohmann::detail::exception& ex);
+
+    // sets fields and cells of 'game' to the ones read
+    void load(Game& game);
+
+  private:
+    // +------------------+
+    // | private methods: |
+    // +------------------+
+
+    // reads value of the current field (or array element), and returns the field it was read into
+    Field value_(ValueType type, int value);
+
+    // checks that fields of the object ending have been read
+    void endCurrentGame_();
+    void endRow_();
+    void endCellEntry_();
+    void endCell_();
+
+    Field field_(const string_t& key) const;
+    void requireFields_(std::initializer_list<Field> fields) const;
+    bool hasRead_(Field field) const;
+    void forget_(std::initializer_list<Field> fields);
+    int valueOf_(Field field) const;
+
+    static ValueType typeOf_(Field field);
+    static const char* keyOf_(Field field);
+};
+
+template <class BinaryType>
+bool Game::JsonLoader::binary(BinaryType& /*val*/) {
+    this->value_(ValueType::OTHER, 0);
+    return true;
+}
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_GAME_JSON_LOADER_H
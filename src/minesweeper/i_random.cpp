@@ -0,0 +1,32 @@
+#include <algorithm> // std::binary_search, std::remove_if
+#include <cassert>   // assert
+#include <numeric>   // std::iota
+#include <vector>    // std::vector
+
+#include <minesweeper/i_random.h>
+
+namespace minesweeper {
+
+void IRandom::chooseIndices(std::vector<int>& chosenIndices, const int numOfChosen, const int numOfIndices,
+                            const std::vector<int>& excludedIndices) {
+
+    assert(numOfChosen >= 0 && numOfChosen <= numOfIndices - static_cast<int>(excludedIndices.size()));
+
+    // to populate chosenIndices vector with values: 0, 1, 2, ..., numOfIndices - 1
+    chosenIndices.resize(numOfIndices);
+    std::iota(chosenIndices.begin(), chosenIndices.end(), 0);
+
+    // to shuffle this vector
+    this->shuffleVector(chosenIndices);
+
+    // to remove excluded indices (in single pass) and keep only the chosen ones
+    chosenIndices.erase(std::remove_if(chosenIndices.begin(), chosenIndices.end(),
+                                       [&excludedIndices](const int index) {
+                                           return std::binary_search(excludedIndices.begin(), excludedIndices.end(),
+                                                                     index);
+                                       }),
+                        chosenIndices.end());
+    chosenIndices.resize(numOfChosen);
+}
+
+} // namespace minesweeper
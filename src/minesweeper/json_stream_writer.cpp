@@ -0,0 +1,169 @@
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstring>  // std::strlen
+#include <iostream> // std::ostream, std::streamsize
+#include <string>   // std::string, std::to_string
+
+#include <minesweeper/json_stream_writer.h>
+
+namespace minesweeper {
+
+// +----------------------------------+
+// | initialisation of static fields: |
+// +----------------------------------+
+
+const int JsonStreamWriter::INDENTATION_WIDTH = 4;
+
+const std::size_t JsonStreamWriter::FLUSH_THRESHOLD = 1 << 16;
+
+JsonStreamWriter::JsonStreamWriter(std::ostream& outStream, const bool prettyPrint)
+    : _outStream(outStream), _prettyPrint(prettyPrint) {
+    this->_buffer.reserve(FLUSH_THRESHOLD + 1'024);
+}
+
+void JsonStreamWriter::beginObject() {
+    this->beginElement_();
+    this->_buffer += '{';
+    ++(this->_depth);
+    this->_isFirstElement = true;
+}
+
+void JsonStreamWriter::endObject() {
+    --(this->_depth);
+    if (!this->_isFirstElement) {
+        this->newLine_(this->_depth);
+    }
+    this->_buffer += '}';
+    this->endElement_();
+}
+
+void JsonStreamWriter::beginArray() {
+    this->beginElement_();
+    this->_buffer += '[';
+    ++(this->_depth);
+    this->_isFirstElement = true;
+}
+
+void JsonStreamWriter::endArray() {
+    --(this->_depth);
+    if (!this->_isFirstElement) {
+        this->newLine_(this->_depth);
+    }
+    this->_buffer += ']';
+    this->endElement_();
+}
+
+void JsonStreamWriter::key(const char* key) {
+    this->beginElement_();
+    this->writeString_(key, std::strlen(key));
+    this->_buffer += this->_prettyPrint ? ": " : ":";
+    this->_isAfterKey = true;
+}
+
+void JsonStreamWriter::value(const int value) {
+    this->beginElement_();
+    this->_buffer += std::to_string(value);
+    this->endElement_();
+}
+
+void JsonStreamWriter::value(const std::uint64_t value) {
+    this->beginElement_();
+    this->_buffer += std::to_string(value);
+    this->endElement_();
+}
+
+void JsonStreamWriter::value(const bool value) {
+    this->beginElement_();
+    this->_buffer += value ? "true" : "false";
+    this->endElement_();
+}
+
+void JsonStreamWriter::value(const std::string& value) {
+    this->beginElement_();
+    this->writeString_(value.data(), value.size());
+    this->endElement_();
+}
+
+void JsonStreamWriter::flush() {
+    this->_outStream.write(this->_buffer.data(), static_cast<std::streamsize>(this->_buffer.size()));
+    this->_numOfBytesWritten += this->_buffer.size();
+    this->_buffer.clear();
+}
+
+std::size_t JsonStreamWriter::numOfBytesWritten() const { return this->_numOfBytesWritten; }
+
+void JsonStreamWriter::writeString_(const char* const str, const std::size_t length) {
+
+    static const char* const HEX_DIGITS = "0123456789abcdef";
+
+    this->_buffer += '"';
+    for (std::size_t i = 0; i < length; ++i) {
+        const char c = str[i];
+        switch (c) {
+        case '"':
+            this->_buffer += "\\\"";
+            break;
+        case '\\':
+            this->_buffer += "\\\\";
+            break;
+        case '\b':
+            this->_buffer += "\\b";
+            break;
+        case '\f':
+            this->_buffer += "\\f";
+            break;
+        case '\n':
+            this->_buffer += "\\n";
+            break;
+        case '\r':
+            this->_buffer += "\\r";
+            break;
+        case '\t':
+            this->_buffer += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                this->_buffer += "\\u00";
+                this->_buffer += HEX_DIGITS[static_cast<unsigned char>(c) >> 4];
+                this->_buffer += HEX_DIGITS[static_cast<unsigned char>(c) & 0x0F];
+            } else {
+                this->_buffer += c;
+            }
+        }
+    }
+    this->_buffer += '"';
+}
+
+void JsonStreamWriter::beginElement_() {
+
+    if (this->_isAfterKey) {
+        // key has already been separated
+        this->_isAfterKey = false;
+        return;
+    }
+
+    if (this->_depth != 0) {
+        if (!this->_isFirstElement) {
+            this->_buffer += ',';
+        }
+        this->newLine_(this->_depth);
+    }
+}
+
+void JsonStreamWriter::endElement_() {
+
+    this->_isFirstElement = false;
+
+    if (this->_buffer.size() >= FLUSH_THRESHOLD) {
+        this->flush();
+    }
+}
+
+void JsonStreamWriter::newLine_(const int depth) {
+    if (this->_prettyPrint) {
+        this->_buffer += '\n';
+        this->_buffer.append(static_cast<std::size_t>(depth) * INDENTATION_WIDTH, ' ');
+    }
+}
+
+} // namespace minesweeper
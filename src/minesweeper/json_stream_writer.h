@@ -0,0 +1,95 @@
+#ifndef MINESWEEPER_JSON_STREAM_WRITER_H
+#define MINESWEEPER_JSON_STREAM_WRITER_H
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <iostream> // std::ostream
+#include <string>   // std::string
+
+namespace minesweeper {
+
+// writes JSON into a stream token by token, without building a document first
+// (output is identical to 'nlohmann::json::dump' with indentation of 4 or without indentation,
+// as long as object keys are written in sorted order, like 'nlohmann::json' stores them)
+class JsonStreamWriter {
+  private:
+    // +----------------------+
+    // | static const fields: |
+    // +----------------------+
+
+    static const int INDENTATION_WIDTH;
+
+    // size of buffered output, after which it is written into the stream
+    static const std::size_t FLUSH_THRESHOLD;
+
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    std::ostream& _outStream;
+    bool _prettyPrint;
+
+    std::string _buffer;
+    int _depth = 0;
+
+    // bytes written into the stream so far
+    std::size_t _numOfBytesWritten = 0;
+
+    // whether current object or array has no elements yet
+    bool _isFirstElement = true;
+    // whether next value belongs to the key written just before it
+    bool _isAfterKey = false;
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // constructor:
+    JsonStreamWriter(std::ostream& outStream, bool prettyPrint);
+
+    JsonStreamWriter(const JsonStreamWriter& other) = delete;
+    JsonStreamWriter& operator=(const JsonStreamWriter& other) = delete;
+
+    // destructor (does not flush, so that nothing is written during stack unwinding):
+    ~JsonStreamWriter() = default;
+
+    // object and array methods:
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    // object key method:
+    void key(const char* key);
+
+    // value methods:
+    void value(int value);
+    void value(std::uint64_t value);
+    void value(bool value);
+    void value(const std::string& value);
+
+    // writes buffered output into the stream
+    void flush();
+
+    // number of bytes written into the stream (by 'flush')
+    std::size_t numOfBytesWritten() const;
+
+  private:
+    // +------------------+
+    // | private methods: |
+    // +------------------+
+
+    // writes quoted and escaped string
+    void writeString_(const char* str, std::size_t length);
+
+    // separates new element from the previous one (or from the key)
+    void beginElement_();
+    void endElement_();
+
+    void newLine_(int depth);
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_JSON_STREAM_WRITER_H
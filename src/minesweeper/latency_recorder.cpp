@@ -0,0 +1,412 @@
+#include <algorithm> // std::max, std::min
+#include <atomic>    // std::atomic, std::memory_order_relaxed
+#include <cmath>     // std::ceil
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int64_t, std::uint64_t
+#include <iostream>  // std::ostream
+#include <limits>    // std::numeric_limits
+#include <memory>    // std::make_unique
+#include <mutex>     // std::mutex, std::lock_guard
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+#include <string>    // std::string
+#include <thread>    // std::thread, std::this_thread
+#include <vector>    // std::vector
+
+#include <minesweeper/json_stream_writer.h>
+#include <minesweeper/latency_recorder.h>
+
+namespace minesweeper {
+
+namespace {
+
+// each power of two of latencies is split into 2^SUB_BUCKET_BITS linear sub-buckets
+// (and latencies below 2^SUB_BUCKET_BITS have a bucket each)
+const int SUB_BUCKET_BITS = 5;
+const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+// latencies, whose highest set bit is above this one, are counted into the last bucket
+const int MAX_EXPONENT = 47;
+
+const int NUM_OF_OPERATIONS = 3;
+const int NUM_OF_BOARD_SIZE_CLASSES = 4;
+const int NUM_OF_HISTOGRAMS = NUM_OF_OPERATIONS * NUM_OF_BOARD_SIZE_CLASSES;
+
+// names of operations and board size classes in JSON (in the order of their enumerators)
+const char* const OPERATION_NAMES[NUM_OF_OPERATIONS] = {"check", "completeAround", "mineGeneration"};
+const char* const BOARD_SIZE_CLASS_NAMES[NUM_OF_BOARD_SIZE_CLASSES] = {"classic", "medium", "large", "veryLarge"};
+
+// largest numbers of cells of board size classes (except for the last one)
+const std::int64_t MAX_NUM_OF_CLASSIC_CELLS = 16 * 30;
+const std::int64_t MAX_NUM_OF_MEDIUM_CELLS = 100 * 100;
+const std::int64_t MAX_NUM_OF_LARGE_CELLS = 1'000 * 1'000;
+
+// number of recorders, whose histograms each thread remembers
+const int NUM_OF_CACHED_RECORDERS = 4;
+
+// identifier of the next recorder (0 is never used, so that it marks empty places in caches)
+std::atomic<std::uint64_t> nextRecorderId{1};
+
+int highestSetBit(std::uint64_t value) {
+
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = -1;
+    while (value != 0) {
+        value >>= 1U;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+bool isValidHistogram(const LatencyOperation operation, const BoardSizeClass boardSizeClass) {
+    return static_cast<int>(operation) < NUM_OF_OPERATIONS &&
+           static_cast<int>(boardSizeClass) < NUM_OF_BOARD_SIZE_CLASSES;
+}
+
+std::size_t histogramIndex(const LatencyOperation operation, const BoardSizeClass boardSizeClass) {
+    return static_cast<std::size_t>(operation) * NUM_OF_BOARD_SIZE_CLASSES + static_cast<std::size_t>(boardSizeClass);
+}
+
+// writes fields of histogram into an object, which has been begun (keys in sorted order, like everywhere else)
+void writeHistogramFields(JsonStreamWriter& writer, const LatencyHistogram& histogram) {
+
+    writer.key("buckets");
+    writer.beginArray();
+    for (int i = 0; i < LatencyHistogram::NUM_OF_BUCKETS; ++i) {
+        const std::uint64_t bucketCount = histogram.bucketCounts()[i];
+        if (bucketCount != 0) {
+            writer.beginArray();
+            writer.value(LatencyHistogram::highestValueOfBucket(i));
+            writer.value(bucketCount);
+            writer.endArray();
+        }
+    }
+    writer.endArray();
+
+    writer.key("count");
+    writer.value(histogram.count());
+    writer.key("max");
+    writer.value(histogram.max());
+    writer.key("p50");
+    writer.value(histogram.valueAtPercentile(50));
+    writer.key("p99");
+    writer.value(histogram.valueAtPercentile(99));
+    writer.key("p999");
+    writer.value(histogram.valueAtPercentile(99.9));
+}
+
+} // namespace
+
+// +----------------------------------+
+// | initialisation of static fields: |
+// +----------------------------------+
+
+// (linear buckets below 2^SUB_BUCKET_BITS, and sub-buckets of every power of two up to 2^MAX_EXPONENT)
+const int LatencyHistogram::NUM_OF_BUCKETS = SUB_BUCKET_COUNT * (MAX_EXPONENT - SUB_BUCKET_BITS + 2);
+
+// +-------------------+
+// | LatencyHistogram: |
+// +-------------------+
+
+LatencyHistogram::LatencyHistogram() : _bucketCounts(static_cast<std::size_t>(NUM_OF_BUCKETS), 0) {}
+
+void LatencyHistogram::record(const std::uint64_t nanoseconds) {
+
+    ++(this->_bucketCounts[bucketIndex(nanoseconds)]);
+    ++(this->_count);
+    this->_max = std::max(this->_max, nanoseconds);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+
+    for (int i = 0; i < NUM_OF_BUCKETS; ++i) {
+        this->_bucketCounts[i] += other._bucketCounts[i];
+    }
+    this->_count += other._count;
+    this->_max = std::max(this->_max, other._max);
+}
+
+void LatencyHistogram::reset() {
+
+    std::fill(this->_bucketCounts.begin(), this->_bucketCounts.end(), 0);
+    this->_count = 0;
+    this->_max = 0;
+}
+
+std::uint64_t LatencyHistogram::count() const { return this->_count; }
+
+std::uint64_t LatencyHistogram::max() const { return this->_max; }
+
+std::uint64_t LatencyHistogram::valueAtPercentile(const double percentile) const {
+
+    if (!(percentile >= 0 && percentile <= 100)) {
+        throw std::out_of_range("LatencyHistogram::valueAtPercentile(const double percentile) const: "
+                                "Percentile has to be from 0 to 100.");
+    }
+
+    if (this->_count == 0) {
+        return 0;
+    }
+
+    // (1-based rank of the latency at percentile)
+    const auto rank = std::min(
+        std::max(static_cast<std::uint64_t>(std::ceil(percentile / 100 * static_cast<double>(this->_count))),
+                 std::uint64_t{1}),
+        this->_count);
+
+    std::uint64_t numOfLatencies = 0;
+    for (int i = 0; i < NUM_OF_BUCKETS; ++i) {
+        numOfLatencies += this->_bucketCounts[i];
+        if (numOfLatencies >= rank) {
+            return std::min(highestValueOfBucket(i), this->_max);
+        }
+    }
+
+    return this->_max;
+}
+
+const std::vector<std::uint64_t>& LatencyHistogram::bucketCounts() const { return this->_bucketCounts; }
+
+// static method
+int LatencyHistogram::bucketIndex(const std::uint64_t nanoseconds) {
+
+    if (nanoseconds < static_cast<std::uint64_t>(SUB_BUCKET_COUNT)) {
+        return static_cast<int>(nanoseconds);
+    }
+
+    const int exponent = highestSetBit(nanoseconds);
+    if (exponent > MAX_EXPONENT) {
+        return NUM_OF_BUCKETS - 1;
+    }
+
+    // (bits below the highest set bit and the sub-bucket bits after it are dropped)
+    const int shift = exponent - SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKET_COUNT + static_cast<int>((nanoseconds >> static_cast<unsigned>(shift)) -
+                                                             static_cast<std::uint64_t>(SUB_BUCKET_COUNT));
+}
+
+// static method
+std::uint64_t LatencyHistogram::lowestValueOfBucket(const int bucketIndex) {
+
+    if (bucketIndex < 0 || bucketIndex >= NUM_OF_BUCKETS) {
+        throw std::out_of_range("LatencyHistogram::lowestValueOfBucket(const int bucketIndex): "
+                                "Trying to use bucket outside histogram.");
+    }
+
+    if (bucketIndex < SUB_BUCKET_COUNT) {
+        return static_cast<std::uint64_t>(bucketIndex);
+    }
+
+    const int shift = bucketIndex / SUB_BUCKET_COUNT - 1;
+    return static_cast<std::uint64_t>(SUB_BUCKET_COUNT + bucketIndex % SUB_BUCKET_COUNT)
+           << static_cast<unsigned>(shift);
+}
+
+// static method
+std::uint64_t LatencyHistogram::highestValueOfBucket(const int bucketIndex) {
+
+    if (bucketIndex < 0 || bucketIndex >= NUM_OF_BUCKETS) {
+        throw std::out_of_range("LatencyHistogram::highestValueOfBucket(const int bucketIndex): "
+                                "Trying to use bucket outside histogram.");
+    }
+
+    // (last bucket also holds every latency too large for the histogram)
+    if (bucketIndex == NUM_OF_BUCKETS - 1) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    if (bucketIndex < SUB_BUCKET_COUNT) {
+        return static_cast<std::uint64_t>(bucketIndex);
+    }
+
+    const int shift = bucketIndex / SUB_BUCKET_COUNT - 1;
+    return lowestValueOfBucket(bucketIndex) + (std::uint64_t{1} << static_cast<unsigned>(shift)) - 1;
+}
+
+std::ostream& LatencyHistogram::serialiseJson(std::ostream& outStream) const {
+
+    JsonStreamWriter writer(outStream, false);
+
+    writer.beginObject();
+    writeHistogramFields(writer, *this);
+    writer.endObject();
+    writer.flush();
+
+    return outStream;
+}
+
+// +------------------+
+// | LatencyRecorder: |
+// +------------------+
+
+struct LatencyRecorder::ThreadHistograms {
+
+    explicit ThreadHistograms(const std::thread::id threadId)
+        : threadId(threadId),
+          bucketCounts(static_cast<std::size_t>(NUM_OF_HISTOGRAMS) * LatencyHistogram::NUM_OF_BUCKETS),
+          maxima(NUM_OF_HISTOGRAMS) {}
+
+    std::thread::id threadId;
+
+    // bucket counts and largest latencies of every histogram of the thread
+    // (value-initialised, hence zero, and written only by the thread, so that recording needs no read-modify-write)
+    std::vector<std::atomic<std::uint64_t>> bucketCounts;
+    std::vector<std::atomic<std::uint64_t>> maxima;
+};
+
+LatencyRecorder::LatencyRecorder() : _id(nextRecorderId.fetch_add(1, std::memory_order_relaxed)) {}
+
+LatencyRecorder::~LatencyRecorder() = default;
+
+void LatencyRecorder::record(const LatencyOperation operation, const BoardSizeClass boardSizeClass,
+                             const std::uint64_t nanoseconds) {
+
+    if (!isValidHistogram(operation, boardSizeClass)) {
+        throw std::invalid_argument(
+            "LatencyRecorder::record(const LatencyOperation operation, const BoardSizeClass boardSizeClass, "
+            "const std::uint64_t nanoseconds): Trying to record into a histogram that does not exist.");
+    }
+
+    ThreadHistograms& histograms = this->threadHistograms_();
+    const std::size_t histogram = histogramIndex(operation, boardSizeClass);
+
+    // (only this thread writes its counters, hence a relaxed load and store can not lose updates,
+    // and threads merging histograms still read whole values)
+    std::atomic<std::uint64_t>& bucketCount =
+        histograms.bucketCounts[histogram * LatencyHistogram::NUM_OF_BUCKETS +
+                                static_cast<std::size_t>(LatencyHistogram::bucketIndex(nanoseconds))];
+    bucketCount.store(bucketCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    std::atomic<std::uint64_t>& max = histograms.maxima[histogram];
+    if (nanoseconds > max.load(std::memory_order_relaxed)) {
+        max.store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram LatencyRecorder::histogram(const LatencyOperation operation,
+                                            const BoardSizeClass boardSizeClass) const {
+
+    if (!isValidHistogram(operation, boardSizeClass)) {
+        throw std::invalid_argument("LatencyRecorder::histogram(const LatencyOperation operation, "
+                                    "const BoardSizeClass boardSizeClass) const: "
+                                    "Trying to get a histogram that does not exist.");
+    }
+
+    const std::size_t histogram = histogramIndex(operation, boardSizeClass);
+    const std::size_t firstBucket = histogram * LatencyHistogram::NUM_OF_BUCKETS;
+
+    LatencyHistogram merged;
+
+    const std::lock_guard<std::mutex> lock(this->_threadHistogramsMutex);
+    for (const std::unique_ptr<ThreadHistograms>& histograms : this->_threadHistograms) {
+        for (int i = 0; i < LatencyHistogram::NUM_OF_BUCKETS; ++i) {
+            const std::uint64_t bucketCount = histograms->bucketCounts[firstBucket + i].load(std::memory_order_relaxed);
+            merged._bucketCounts[i] += bucketCount;
+            merged._count += bucketCount;
+        }
+        merged._max = std::max(merged._max, histograms->maxima[histogram].load(std::memory_order_relaxed));
+    }
+
+    return merged;
+}
+
+void LatencyRecorder::reset() {
+
+    const std::lock_guard<std::mutex> lock(this->_threadHistogramsMutex);
+    for (const std::unique_ptr<ThreadHistograms>& histograms : this->_threadHistograms) {
+        for (std::atomic<std::uint64_t>& bucketCount : histograms->bucketCounts) {
+            bucketCount.store(0, std::memory_order_relaxed);
+        }
+        for (std::atomic<std::uint64_t>& max : histograms->maxima) {
+            max.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::ostream& LatencyRecorder::serialiseJson(std::ostream& outStream) const {
+
+    JsonStreamWriter writer(outStream, false);
+
+    writer.beginObject();
+    writer.key("histograms");
+    writer.beginArray();
+    for (int operation = 0; operation < NUM_OF_OPERATIONS; ++operation) {
+        for (int boardSizeClass = 0; boardSizeClass < NUM_OF_BOARD_SIZE_CLASSES; ++boardSizeClass) {
+            writer.beginObject();
+            writer.key("boardSizeClass");
+            writer.value(std::string(BOARD_SIZE_CLASS_NAMES[boardSizeClass]));
+            writeHistogramFields(writer, this->histogram(static_cast<LatencyOperation>(operation),
+                                                         static_cast<BoardSizeClass>(boardSizeClass)));
+            writer.key("operation");
+            writer.value(std::string(OPERATION_NAMES[operation]));
+            writer.endObject();
+        }
+    }
+    writer.endArray();
+    writer.endObject();
+    writer.flush();
+
+    return outStream;
+}
+
+// static method
+BoardSizeClass LatencyRecorder::boardSizeClass(const int gridHeight, const int gridWidth) {
+
+    const std::int64_t numOfCells = static_cast<std::int64_t>(gridHeight) * gridWidth;
+
+    if (numOfCells <= MAX_NUM_OF_CLASSIC_CELLS) {
+        return BoardSizeClass::CLASSIC;
+    }
+    if (numOfCells <= MAX_NUM_OF_MEDIUM_CELLS) {
+        return BoardSizeClass::MEDIUM;
+    }
+    if (numOfCells <= MAX_NUM_OF_LARGE_CELLS) {
+        return BoardSizeClass::LARGE;
+    }
+    return BoardSizeClass::VERY_LARGE;
+}
+
+LatencyRecorder::ThreadHistograms& LatencyRecorder::threadHistograms_() {
+
+    // histograms of the calling thread in recently used recorders (by identifier of the recorder)
+    struct CachedThreadHistograms {
+        std::uint64_t recorderId;
+        ThreadHistograms* histograms;
+    };
+    thread_local CachedThreadHistograms cachedHistograms[NUM_OF_CACHED_RECORDERS] = {};
+    thread_local int nextCacheIndex = 0;
+
+    for (const CachedThreadHistograms& cached : cachedHistograms) {
+        if (cached.recorderId == this->_id) {
+            return *(cached.histograms);
+        }
+    }
+
+    // histograms of a thread are found again by its identifier, if they have dropped out of its cache
+    // (and a new thread, which gets the identifier of a finished one, continues recording into its histograms)
+    ThreadHistograms* histograms = nullptr;
+    {
+        const std::lock_guard<std::mutex> lock(this->_threadHistogramsMutex);
+
+        const std::thread::id threadId = std::this_thread::get_id();
+        for (const std::unique_ptr<ThreadHistograms>& threadHistograms : this->_threadHistograms) {
+            if (threadHistograms->threadId == threadId) {
+                histograms = threadHistograms.get();
+                break;
+            }
+        }
+        if (histograms == nullptr) {
+            this->_threadHistograms.push_back(std::make_unique<ThreadHistograms>(threadId));
+            histograms = this->_threadHistograms.back().get();
+        }
+    }
+
+    cachedHistograms[nextCacheIndex] = CachedThreadHistograms{this->_id, histograms};
+    nextCacheIndex = (nextCacheIndex + 1) % NUM_OF_CACHED_RECORDERS;
+
+    return *histograms;
+}
+
+} // namespace minesweeper
@@ -0,0 +1,48 @@
+#ifndef MINESWEEPER_MEMORY_STREAM_BUFFER_H
+#define MINESWEEPER_MEMORY_STREAM_BUFFER_H
+
+#include <cstddef>   // std::size_t
+#include <streambuf> // std::streambuf, std::streamsize
+
+// stream buffers used by 'Game' to serialise JSON into (and deserialise it from) caller-provided memory
+namespace minesweeper {
+
+// reads from and writes into a fixed-size range of memory
+// (writing past the end of the range fails, instead of growing it)
+class MemoryStreamBuffer : public std::streambuf {
+  public:
+    MemoryStreamBuffer(char* begin, std::size_t size) {
+        this->setg(begin, begin, begin + size);
+        this->setp(begin, begin + size);
+    }
+
+    // (range is only read, when constructed from read-only memory)
+    MemoryStreamBuffer(const char* begin, std::size_t size) : MemoryStreamBuffer(const_cast<char*>(begin), size) {}
+
+    std::size_t numOfBytesRead() const { return static_cast<std::size_t>(this->gptr() - this->eback()); }
+    std::size_t numOfBytesWritten() const { return static_cast<std::size_t>(this->pptr() - this->pbase()); }
+};
+
+// only counts the number of written bytes
+class CountingStreamBuffer : public std::streambuf {
+  public:
+    std::size_t numOfBytesWritten() const { return this->_numOfBytesWritten; }
+
+  protected:
+    std::streamsize xsputn(const char* /*s*/, std::streamsize count) override {
+        this->_numOfBytesWritten += static_cast<std::size_t>(count);
+        return count;
+    }
+
+    int_type overflow(int_type ch) override {
+        ++this->_numOfBytesWritten;
+        return traits_type::not_eof(ch);
+    }
+
+  private:
+    std::size_t _numOfBytesWritten = 0;
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_MEMORY_STREAM_BUFFER_H
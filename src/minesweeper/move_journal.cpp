@@ -0,0 +1,72 @@
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+
+#include <minesweeper/move_journal.h>
+
+namespace minesweeper {
+
+void MoveJournal::beginMove(const Counters& countersBefore) {
+
+    // (moves which were undone can not be redone after a new move)
+    this->_moves.resize(this->_numOfMovesDone);
+    this->_cellChanges.resize(this->_moves.empty() ? 0 : this->_moves.back().endCellChange);
+
+    this->_isRecording = true;
+    this->_countersBeforeMove = countersBefore;
+}
+
+void MoveJournal::addCellChange(const int cellIndex, const CellChangeType type) {
+    if (this->_isRecording) {
+        this->_cellChanges.push_back(JournalledCellChange{cellIndex, type});
+    }
+}
+
+void MoveJournal::endMove(const Counters& countersAfter) {
+
+    assert(this->_isRecording);
+
+    const std::size_t firstCellChange = this->_moves.empty() ? 0 : this->_moves.back().endCellChange;
+    if (this->_cellChanges.size() != firstCellChange) {
+        this->_moves.push_back(
+            Move{firstCellChange, this->_cellChanges.size(), this->_countersBeforeMove, countersAfter});
+        this->_numOfMovesDone = this->_moves.size();
+    }
+
+    this->_isRecording = false;
+}
+
+bool MoveJournal::canUndo() const { return this->_numOfMovesDone != 0; }
+
+bool MoveJournal::canRedo() const { return this->_numOfMovesDone != this->_moves.size(); }
+
+const MoveJournal::Move& MoveJournal::undo() {
+
+    assert(this->canUndo());
+
+    --(this->_numOfMovesDone);
+    return this->_moves[this->_numOfMovesDone];
+}
+
+const MoveJournal::Move& MoveJournal::redo() {
+
+    assert(this->canRedo());
+
+    ++(this->_numOfMovesDone);
+    return this->_moves[this->_numOfMovesDone - 1];
+}
+
+const MoveJournal::JournalledCellChange& MoveJournal::cellChange(const std::size_t index) const {
+
+    assert(index < this->_cellChanges.size());
+
+    return this->_cellChanges[index];
+}
+
+void MoveJournal::clear() {
+    this->_moves.clear();
+    this->_numOfMovesDone = 0;
+    this->_cellChanges.clear();
+    this->_isRecording = false;
+}
+
+} // namespace minesweeper
@@ -0,0 +1,82 @@
+#ifndef MINESWEEPER_MOVE_JOURNAL_H
+#define MINESWEEPER_MOVE_JOURNAL_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+#include <vector>  // std::vector
+
+namespace minesweeper {
+
+// journal of moves of 'Game', which keeps the cell changes and counters of each move,
+// so that moves can be undone and redone in time proportional to the number of cells they changed
+// (cells are referred to by their indices in the cell storage of 'Game')
+class MoveJournal {
+  public:
+    // +--------+
+    // | types: |
+    // +--------+
+
+    enum class CellChangeType : std::uint8_t { REVEAL, MARK, UNMARK };
+
+    struct JournalledCellChange {
+        int cellIndex;
+        CellChangeType type;
+    };
+
+    // counters of 'Game' before or after a move
+    struct Counters {
+        int numOfMarkedMines;
+        int numOfWronglyMarkedCells;
+        int numOfVisibleCells;
+        bool checkedMine;
+    };
+
+    // cell changes of a move are journalled cell changes from 'firstCellChange' up to 'endCellChange'
+    struct Move {
+        std::size_t firstCellChange;
+        std::size_t endCellChange;
+        Counters countersBefore;
+        Counters countersAfter;
+    };
+
+  private:
+    // +---------+
+    // | fields: |
+    // +---------+
+
+    // moves before '_numOfMovesDone' can be undone, and the rest can be redone
+    std::vector<Move> _moves;
+    std::size_t _numOfMovesDone = 0;
+
+    std::vector<JournalledCellChange> _cellChanges;
+
+    // move currently being made
+    bool _isRecording = false;
+    Counters _countersBeforeMove{};
+
+  public:
+    // +-----------------+
+    // | public methods: |
+    // +-----------------+
+
+    // move recording methods:
+    // (beginning a move drops moves which could have been redone, and moves without cell changes are not kept)
+    void beginMove(const Counters& countersBefore);
+    void addCellChange(int cellIndex, CellChangeType type);
+    void endMove(const Counters& countersAfter);
+
+    // undo and redo methods:
+    // (caller reverts or reapplies cell changes of the returned move)
+    bool canUndo() const;
+    bool canRedo() const;
+    const Move& undo();
+    const Move& redo();
+    const JournalledCellChange& cellChange(std::size_t index) const;
+
+    // forgets all moves
+    void clear();
+};
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_MOVE_JOURNAL_H
@@ -1,11 +1,23 @@
 #include <algorithm> // std::shuffle
+#include <random>    // std::random_device, std::uniform_int_distribution
+#include <vector>    // std::vector
 
 #include <minesweeper/random.h>
+#include <minesweeper/sampling.h>
 
 namespace minesweeper {
 
-Random::Random() : _uRng(_rd()) {}
+Random::Random() : _uRng(std::random_device{}()) {}
+
+Random::Random(const std::mt19937::result_type seed) : _uRng(seed) {}
 
 void Random::shuffleVector(std::vector<int>& vec) { std::shuffle(vec.begin(), vec.end(), this->_uRng); }
 
+void Random::chooseIndices(std::vector<int>& chosenIndices, const int numOfChosen, const int numOfIndices,
+                           const std::vector<int>& excludedIndices) {
+
+    sampleIndices([this](const int upperBound) { return std::uniform_int_distribution<int>(0, upperBound)(this->_uRng); },
+                  chosenIndices, numOfChosen, numOfIndices, excludedIndices);
+}
+
 } // namespace minesweeper
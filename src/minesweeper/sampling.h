@@ -0,0 +1,114 @@
+#ifndef MINESWEEPER_SAMPLING_H
+#define MINESWEEPER_SAMPLING_H
+
+#include <cassert>       // assert
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+namespace minesweeper {
+
+// maps rank of a non-excluded index into the index itself
+// (eg. with ascending excluded indices {1, 2}, ranks 0, 1, 2 map to indices 0, 3, 4)
+inline int rankToIndex(const int rank, const std::vector<int>& excludedIndices) {
+
+    int index = rank;
+    for (const int excludedIndex : excludedIndices) {
+        if (excludedIndex > index) {
+            break;
+        }
+        ++index;
+    }
+    return index;
+}
+
+// Robert Floyd's sampling algorithm:
+// calls 'chosenRankFunction' with 'numOfChosen' distinct ranks from [0, numOfRanks)
+// ('uniformFunction(upperRank)' must return uniformly random int from [0, upperRank],
+//  'insertFunction(rank)' must remember rank and return whether it was new)
+template <class UniformFunction, class InsertFunction, class ChosenRankFunction>
+void floydSample(UniformFunction& uniformFunction, const int numOfChosen, const int numOfRanks,
+                 InsertFunction insertFunction, ChosenRankFunction& chosenRankFunction) {
+
+    for (int upperRank = numOfRanks - numOfChosen; upperRank < numOfRanks; ++upperRank) {
+
+        int rank = uniformFunction(upperRank);
+        if (!insertFunction(rank)) {
+            rank = upperRank;
+            insertFunction(rank);
+        }
+
+        chosenRankFunction(rank);
+    }
+}
+
+template <class UniformFunction, class ChosenRankFunction>
+void floydSample(UniformFunction uniformFunction, const int numOfChosen, const int numOfRanks,
+                 ChosenRankFunction chosenRankFunction) {
+
+    // bit per rank is cheaper than hashing, unless ranks vastly outnumber chosen ones
+    if (numOfRanks / 64 <= numOfChosen) {
+        std::vector<bool> isChosen(numOfRanks, false);
+        floydSample(
+            uniformFunction, numOfChosen, numOfRanks,
+            [&isChosen](const int rank) {
+                if (isChosen[rank]) {
+                    return false;
+                }
+                isChosen[rank] = true;
+                return true;
+            },
+            chosenRankFunction);
+    } else {
+        std::unordered_set<int> chosenRanks;
+        chosenRanks.reserve(numOfChosen);
+        floydSample(
+            uniformFunction, numOfChosen, numOfRanks,
+            [&chosenRanks](const int rank) { return chosenRanks.insert(rank).second; }, chosenRankFunction);
+    }
+}
+
+// chooses 'numOfChosen' distinct indices from [0, numOfIndices) which are not in (ascending) 'excludedIndices'
+// (time taken depends only on 'numOfChosen', unless more than half of the non-excluded indices are chosen)
+template <class UniformFunction>
+void sampleIndices(UniformFunction uniformFunction, std::vector<int>& chosenIndices, const int numOfChosen,
+                   const int numOfIndices, const std::vector<int>& excludedIndices) {
+
+    const int numOfRanks = numOfIndices - static_cast<int>(excludedIndices.size());
+
+    assert(numOfChosen >= 0 && numOfChosen <= numOfRanks);
+
+    chosenIndices.clear();
+    chosenIndices.reserve(numOfChosen);
+
+    if (2 * numOfChosen <= numOfRanks) {
+
+        // sparse: sample chosen ranks directly
+        floydSample(uniformFunction, numOfChosen, numOfRanks, [&chosenIndices, &excludedIndices](const int rank) {
+            chosenIndices.push_back(rankToIndex(rank, excludedIndices));
+        });
+
+    } else {
+
+        // dense: sample ranks that are not chosen, and choose the rest
+        std::vector<bool> notChosen(numOfRanks, false);
+        floydSample(uniformFunction, numOfRanks - numOfChosen, numOfRanks,
+                    [&notChosen](const int rank) { notChosen[rank] = true; });
+
+        auto excludedIt = excludedIndices.begin();
+        int rank = 0;
+        for (int index = 0; index < numOfIndices; ++index) {
+            if (excludedIt != excludedIndices.end() && *excludedIt == index) {
+                ++excludedIt;
+            } else {
+                if (!notChosen[rank]) {
+                    chosenIndices.push_back(index);
+                }
+                ++rank;
+            }
+        }
+    }
+}
+
+} // namespace minesweeper
+
+#endif // MINESWEEPER_SAMPLING_H
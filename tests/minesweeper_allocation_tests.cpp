@@ -0,0 +1,252 @@
+#include <algorithm> // std::shuffle
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::max_align_t, std::size_t
+#include <cstdint>   // std::int8_t
+#include <cstdlib>   // std::malloc, std::free
+#include <iterator>  // std::back_inserter
+#include <new>       // std::bad_alloc
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+#include <gtest/gtest.h>
+
+#include <minesweeper/game.h>
+#include <minesweeper/i_random.h>
+#include <minesweeper/visual_minesweeper_cell.h>
+
+// +-----------------------------------------------+
+// | global allocation counting (for this binary): |
+// +-----------------------------------------------+
+
+namespace {
+
+std::atomic<bool> countAllocations{false};
+std::atomic<std::size_t> numOfAllocations{0};
+std::atomic<std::size_t> numOfAllocatedBytes{0};
+
+// bytes currently allocated, and the most of them since 'peakLiveBytes' was last reset
+// (size of each allocation is kept in front of it, so that deallocations can be subtracted)
+std::atomic<std::size_t> liveBytes{0};
+std::atomic<std::size_t> peakLiveBytes{0};
+constexpr std::size_t SIZE_PREFIX = alignof(std::max_align_t);
+
+void* countedAllocation(std::size_t size) {
+
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        numOfAllocations.fetch_add(1, std::memory_order_relaxed);
+        numOfAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void* ptr = std::malloc(SIZE_PREFIX + size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(ptr) = size;
+
+    const std::size_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = peakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    return static_cast<char*>(ptr) + SIZE_PREFIX;
+}
+
+void countedDeallocation(void* ptr) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+
+    void* allocation = static_cast<char*>(ptr) - SIZE_PREFIX;
+    liveBytes.fetch_sub(*static_cast<std::size_t*>(allocation), std::memory_order_relaxed);
+    std::free(allocation);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAllocation(size); }
+void* operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void* ptr) noexcept { countedDeallocation(ptr); }
+void operator delete[](void* ptr) noexcept { countedDeallocation(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { countedDeallocation(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { countedDeallocation(ptr); }
+
+class MinesweeperAllocationTest : public ::testing::Test {
+  protected:
+    // counts heap allocations made while 'function' runs
+    template <class Function>
+    std::size_t allocationsDuring(Function function) const {
+
+        numOfAllocations = 0;
+        countAllocations = true;
+        function();
+        countAllocations = false;
+
+        return numOfAllocations;
+    }
+
+    // counts heap allocated bytes while 'function' runs
+    template <class Function>
+    std::size_t allocatedBytesDuring(Function function) const {
+
+        numOfAllocatedBytes = 0;
+        countAllocations = true;
+        function();
+        countAllocations = false;
+
+        return numOfAllocatedBytes;
+    }
+
+    // heap memory (per cell of the grid) held by a game created by 'createGame',
+    // and the most of it held at once while it was created
+    struct Footprint {
+        double bytesPerCell;
+        double peakBytesPerCell;
+    };
+    template <class CreateGame>
+    Footprint footprintOf(CreateGame createGame) const {
+
+        const std::size_t liveBefore = liveBytes;
+        peakLiveBytes = liveBefore;
+
+        const minesweeper::Game game = createGame();
+        const double numOfCells = static_cast<double>(game.getGridHeight()) * game.getGridWidth();
+
+        return Footprint{static_cast<double>(liveBytes - liveBefore) / numOfCells,
+                         static_cast<double>(peakLiveBytes - liveBefore) / numOfCells};
+    }
+
+    // seeded random, so that grids are identical on every run
+    class SeededRandom : public minesweeper::IRandom {
+      public:
+        void shuffleVector(std::vector<int>& vec) override { std::shuffle(vec.begin(), vec.end(), this->_uRng); }
+
+      private:
+        std::mt19937 _uRng{1337};
+    };
+
+    SeededRandom seededRandom;
+};
+
+TEST_F(MinesweeperAllocationTest, CheckInputCoordinatesAllocationTest) {
+
+    // mine free grid opens completely on the first check
+    // (first check creates mines and grows the internal check queue, hence it is allowed to allocate)
+    minesweeper::Game openGame(200, 300, 0, &seededRandom);
+    EXPECT_GT(allocationsDuring([&openGame] { openGame.checkInputCoordinates(150, 100); }), 0);
+    ASSERT_TRUE(openGame.playerHasWon());
+
+    // the same opening again, now without any heap allocations
+    openGame.reset(true);
+    EXPECT_EQ(allocationsDuring([&openGame] { openGame.checkInputCoordinates(150, 100); }), 0);
+    EXPECT_TRUE(openGame.playerHasWon());
+
+    // normal grid with openings and numbers, every non-mine cell checked one by one
+    // (first round is again allowed to allocate)
+    minesweeper::Game normalGame(100, 100, 0.15, &seededRandom);
+    auto checkAllNonMines = [&normalGame] {
+        for (int y = 0; y < normalGame.getGridHeight(); ++y) {
+            for (int x = 0; x < normalGame.getGridWidth(); ++x) {
+                if (!normalGame.doesCellHaveMine(x, y)) {
+                    normalGame.checkInputCoordinates(x, y);
+                }
+            }
+        }
+    };
+    normalGame.checkInputCoordinates(50, 50);
+    checkAllNonMines();
+    ASSERT_TRUE(normalGame.playerHasWon());
+
+    normalGame.reset(true);
+    EXPECT_EQ(allocationsDuring(checkAllNonMines), 0);
+    EXPECT_TRUE(normalGame.playerHasWon());
+}
+
+TEST_F(MinesweeperAllocationTest, MarkAndCompleteAroundInputCoordinatesAllocationTest) {
+
+    minesweeper::Game game(60, 80, 0.2, &seededRandom);
+    game.checkInputCoordinates(40, 30);
+
+    // marking and unmarking every cell
+    EXPECT_EQ(allocationsDuring([&game] {
+                  for (int y = 0; y < game.getGridHeight(); ++y) {
+                      for (int x = 0; x < game.getGridWidth(); ++x) {
+                          game.markInputCoordinates(x, y);
+                          game.markInputCoordinates(x, y);
+                      }
+                  }
+              }),
+              0);
+
+    // completing around the initially checked cell
+    EXPECT_EQ(allocationsDuring([&game] { game.completeAroundInputCoordinates(40, 30); }), 0);
+}
+
+TEST_F(MinesweeperAllocationTest, VisualiseIntoCallerStorageAllocationTest) {
+
+    minesweeper::Game game(100, 120, 0.15, &seededRandom);
+    game.checkInputCoordinates(60, 50);
+    const std::size_t numOfCells = 100 * 120;
+
+    // buffers of every cell type
+    std::vector<minesweeper::VisualMinesweeperCell> visualBuffer(numOfCells);
+    std::vector<std::int8_t> compactBuffer(numOfCells);
+    std::vector<int> intBuffer(numOfCells);
+    EXPECT_EQ(allocationsDuring([&] {
+                  game.visualise(visualBuffer.data(), visualBuffer.size());
+                  game.visualise(compactBuffer.data(), compactBuffer.size());
+                  game.visualise(intBuffer.data(), intBuffer.size());
+                  game.visualiseSolution(visualBuffer.data(), visualBuffer.size());
+                  game.visualiseSolutionData(compactBuffer.data(), compactBuffer.size());
+              }),
+              0);
+
+    // output iterators (into a container with enough capacity)
+    std::vector<minesweeper::VisualMinesweeperCell> visualisation;
+    visualisation.reserve(numOfCells);
+    EXPECT_EQ(allocatedBytesDuring([&] {
+                  game.visualise(visualBuffer.begin());
+                  game.visualise(std::back_inserter(visualisation));
+              }),
+              0);
+    EXPECT_EQ(visualisation, visualBuffer);
+}
+
+TEST_F(MinesweeperAllocationTest, MemoryFootprintTest) {
+
+    // (cells take a byte each, and rows and columns are bounded by a border cell at each end)
+    const double maxBytesPerCell = 1.5;
+    // (mines are chosen from a vector of every cell index, hence the first check needs temporarily more memory)
+    const double maxPeakBytesPerCell = 6;
+
+    // (widths just below a power of two included, which would nearly double the memory if rows were padded)
+    for (int gridSize : {100, 127, 1'000, 1'023}) {
+        const Footprint started = footprintOf([this, gridSize] {
+            minesweeper::Game game(gridSize, 0.2, &seededRandom);
+            game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+            return game;
+        });
+        EXPECT_LE(started.bytesPerCell, maxBytesPerCell) << "grid size: " << gridSize;
+        EXPECT_LE(started.peakBytesPerCell, maxPeakBytesPerCell) << "grid size: " << gridSize;
+
+        // move journal holds only changes made by moves (here a small opening and a mark)
+        const Footprint journalled = footprintOf([this, gridSize] {
+            minesweeper::Game game(gridSize, 0.2, &seededRandom);
+            game.enableMoveJournal();
+            game.checkInputCoordinates(gridSize / 2, gridSize / 2);
+            game.markInputCoordinates(0, 0);
+            return game;
+        });
+        EXPECT_LE(journalled.bytesPerCell, maxBytesPerCell) << "grid size: " << gridSize;
+    }
+}
+
+TEST_F(MinesweeperAllocationTest, NewGameAllocationTest) {
+
+    // new game initialises cells of a single grid (of the new dimensions), which take a byte each
+    minesweeper::Game game(1'000, 0.2, &seededRandom);
+    game.checkInputCoordinates(500, 500);
+    const std::size_t numOfNewCells = 800 * 1'200;
+    EXPECT_LE(allocatedBytesDuring([&game] { game.newGame(800, 1'200, 0.2); }), numOfNewCells * 3 / 2);
+    EXPECT_LE(allocatedBytesDuring([&game] { game.newGame(800, 1'200, 1'000); }), numOfNewCells * 3 / 2);
+}
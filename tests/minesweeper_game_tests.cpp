@@ -1,19 +1,31 @@
-#include <algorithm> // std::find, std::iter_swap
+#include <algorithm> // std::copy, std::count, std::find, std::iter_swap, std::sort
 #include <cmath>     // std::abs
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int8_t, std::uint64_t
 #include <fstream>   // std::ifstream
+#include <iterator>  // std::back_inserter
 #include <list>      // std::list
+#include <queue>     // std::queue
 #include <sstream>   // std::stringstream, std::ostringstream, std::istringstream
 #include <stdexcept> // std::out_of_range, std::invalid_argument
 #include <string>    // std::string, std::to_string
-#include <utility>   // std::move
+#include <thread>    // std::thread
+#include <utility>   // std::move, std::pair
 #include <vector>    // std::vector
 
 #include <gtest/gtest.h>
 
 #include <test_config.h>
 
+#include <minesweeper/action_log.h>
+#include <minesweeper/cell_change.h>
+#include <minesweeper/fast_random.h>
 #include <minesweeper/game.h>
+#include <minesweeper/game_stats.h>
+#include <minesweeper/latency_recorder.h>
 #include <minesweeper/random.h>
+#include <minesweeper/reveal_engine.h>
+#include <minesweeper/serialisation_format.h>
 #include <minesweeper/visual_minesweeper_cell.h>
 
 class MinesweeperGameTest : public ::testing::Test {
@@ -909,6 +921,91 @@ TEST_F(MinesweeperGameTest, CreateMinesAndNumsTest) {
     EXPECT_THROW(alreadySetByCheckCreateMinesAndNumsGame.createMinesAndNums(12, 6), std::invalid_argument);
 }
 
+TEST_F(MinesweeperGameTest, FirstCheckSafetyTest) {
+
+    // first check and its neighbours never have mines, also at the edges and with maximum number of mines
+    // (Since the grid is randomly generated, this will check different grid each time.)
+    for (int i = 0; i < 50; ++i) {
+        const int x = i % 10;
+        const int y = (i * 7) % 12;
+
+        minesweeper::Game maxMinesGame(12, 10, minesweeper::Game::maxNumOfMines(12, 10), &myRandom);
+        maxMinesGame.checkInputCoordinates(x, y);
+        EXPECT_FALSE(maxMinesGame.playerHasLost());
+
+        int numOfMines = 0;
+        for (int cellY = 0; cellY < maxMinesGame.getGridHeight(); ++cellY) {
+            for (int cellX = 0; cellX < maxMinesGame.getGridWidth(); ++cellX) {
+                if (maxMinesGame.doesCellHaveMine(cellX, cellY)) {
+                    ++numOfMines;
+                    EXPECT_FALSE(std::abs(cellX - x) <= 1 && std::abs(cellY - y) <= 1);
+                }
+            }
+        }
+        EXPECT_EQ(numOfMines, maxMinesGame.getNumOfMines());
+
+        minesweeper::Game sparseGame(40, 30, 0.05, &myRandom);
+        sparseGame.checkInputCoordinates(x, y);
+        EXPECT_FALSE(sparseGame.playerHasLost());
+        EXPECT_EQ(sparseGame.numOfMinesAroundCell(x, y), 0);
+    }
+}
+
+TEST_F(MinesweeperGameTest, CreateMinesAndNumsNumbersTest) {
+
+    // reference numbers (incrementing the eight neighbours of each mine one by one) using only the public interface
+    auto expectedNumbers = [](const minesweeper::Game& game) {
+        const int height = game.getGridHeight();
+        const int width = game.getGridWidth();
+        std::vector<int> numbers(static_cast<std::size_t>(height) * width, 0);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (!game.doesCellHaveMine(x, y)) {
+                    continue;
+                }
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        const int neighbourX = x + dx;
+                        const int neighbourY = y + dy;
+                        if ((dx != 0 || dy != 0) && neighbourX >= 0 && neighbourY >= 0 && neighbourX < width &&
+                            neighbourY < height) {
+                            ++numbers[neighbourY * width + neighbourX];
+                        }
+                    }
+                }
+            }
+        }
+        return numbers;
+    };
+
+    // grid widths around multiples of 64 test counting across words
+    const std::vector<std::pair<int, int>> gridDimensions{{1, 70}, {70, 1},  {3, 3},   {9, 9},
+                                                          {16, 63}, {17, 64}, {18, 65}, {33, 130}};
+    minesweeper::FastRandom fastRandom(2021);
+
+    for (const auto& dimensions : gridDimensions) {
+        const int height = dimensions.first;
+        const int width = dimensions.second;
+
+        // from no mines to as many as possible (sparse mines have their numbers incremented mine by mine)
+        for (const double partOfMaxMines : {0.0, 0.05, 0.2, 0.6, 1.0}) {
+            const double proportionOfMines = partOfMaxMines * minesweeper::Game::maxProportionOfMines(height, width);
+            minesweeper::Game game(height, width, proportionOfMines, &fastRandom);
+            game.createMinesAndNums(static_cast<int>(fastRandom.uniformInt(width - 1)),
+                                    static_cast<int>(fastRandom.uniformInt(height - 1)));
+
+            std::vector<int> actual;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    actual.push_back(game.numOfMinesAroundCell(x, y));
+                }
+            }
+            EXPECT_EQ(actual, expectedNumbers(game))
+                << height << "x" << width << ", proportion of mines: " << proportionOfMines;
+        }
+    }
+}
+
 TEST_F(MinesweeperGameTest, ResetTest) {
 
     // unstarted game should not change after reset
@@ -1498,6 +1595,230 @@ TEST_F(MinesweeperGameTest, CheckInputCoordinatesTest) {
     EXPECT_TRUE(validCheckInputCoordsGame.isCellVisible(9, 20));
 }
 
+TEST_F(MinesweeperGameTest, CheckInputCoordinatesOpeningTest) {
+
+    // reference flood fill (breadth first, one cell at a time) using only the public interface
+    auto expectedVisibility = [](const minesweeper::Game& game, const int checkedX, const int checkedY) {
+        const int height = game.getGridHeight();
+        const int width = game.getGridWidth();
+        std::vector<bool> visible(static_cast<std::size_t>(height) * width, false);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                visible[y * width + x] = game.isCellVisible(x, y);
+            }
+        }
+
+        std::queue<std::pair<int, int>> cellsToCheck;
+        cellsToCheck.emplace(checkedX, checkedY);
+        while (!cellsToCheck.empty()) {
+            const int x = cellsToCheck.front().first;
+            const int y = cellsToCheck.front().second;
+            cellsToCheck.pop();
+
+            if (x < 0 || y < 0 || x >= width || y >= height || visible[y * width + x] || game.isCellMarked(x, y)) {
+                continue;
+            }
+            visible[y * width + x] = true;
+
+            if (!game.doesCellHaveMine(x, y) && game.numOfMinesAroundCell(x, y) == 0) {
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        cellsToCheck.emplace(x + dx, y + dy);
+                    }
+                }
+            }
+        }
+        return visible;
+    };
+
+    minesweeper::FastRandom fastRandom(2021);
+
+    for (const double proportionOfMines : {0.0, 0.05, 0.15, 0.3}) {
+        minesweeper::Game game(37, 53, proportionOfMines, &fastRandom);
+        game.createMinesAndNums(26, 18);
+
+        // marks block openings
+        for (int i = 0; i < 40; ++i) {
+            const int x = static_cast<int>(fastRandom.uniformInt(52));
+            const int y = static_cast<int>(fastRandom.uniformInt(36));
+            if (!game.isCellMarked(x, y) && !(x == 26 && y == 18)) {
+                game.markInputCoordinates(x, y);
+            }
+        }
+
+        const std::vector<bool> expected = expectedVisibility(game, 26, 18);
+        game.checkInputCoordinates(26, 18);
+        std::vector<bool> actual;
+        for (int y = 0; y < game.getGridHeight(); ++y) {
+            for (int x = 0; x < game.getGridWidth(); ++x) {
+                actual.push_back(game.isCellVisible(x, y));
+            }
+        }
+        EXPECT_EQ(actual, expected) << "proportion of mines: " << proportionOfMines;
+        EXPECT_FALSE(game.playerHasLost());
+
+        // checking the rest of the non-mine cells has to win the game exactly at the end,
+        // which would not happen if openings had miscounted their visible cells
+        // (grid without mines is won as soon as nothing is marked)
+        for (int y = 0; y < game.getGridHeight(); ++y) {
+            for (int x = 0; x < game.getGridWidth(); ++x) {
+                if (game.isCellMarked(x, y)) {
+                    game.markInputCoordinates(x, y);
+                }
+            }
+        }
+        for (int y = 0; y < game.getGridHeight(); ++y) {
+            for (int x = 0; x < game.getGridWidth(); ++x) {
+                if (!game.doesCellHaveMine(x, y) && !game.isCellVisible(x, y)) {
+                    EXPECT_TRUE(game.getNumOfMines() == 0 || !game.playerHasWon());
+                    game.checkInputCoordinates(x, y);
+                }
+            }
+        }
+        EXPECT_TRUE(game.playerHasWon());
+    }
+}
+
+TEST_F(MinesweeperGameTest, RevealEngineTest) {
+
+    // default engine, kept by copies
+    minesweeper::Game defaultEngineGame(10, 12, &myRandom);
+    EXPECT_EQ(defaultEngineGame.getRevealEngine(), minesweeper::RevealEngine::SCANLINE);
+    minesweeper::Game bitboardEngineGame(10, 12, &myRandom, minesweeper::RevealEngine::BITBOARD);
+    EXPECT_EQ(bitboardEngineGame.getRevealEngine(), minesweeper::RevealEngine::BITBOARD);
+    minesweeper::Game bitboardEngineGameCopy(bitboardEngineGame);
+    EXPECT_EQ(bitboardEngineGameCopy.getRevealEngine(), minesweeper::RevealEngine::BITBOARD);
+
+    // both engines have to play identically,
+    // grid widths around multiples of 64 test runs continuing from one word to the next
+    const std::vector<std::pair<int, int>> gridDimensions{{1, 70},  {70, 1},  {9, 9},   {16, 63},  {17, 64},
+                                                          {18, 65}, {40, 128}, {33, 130}, {120, 200}};
+
+    for (const auto& dimensions : gridDimensions) {
+        for (const double proportionOfMines : {0.0, 0.01, 0.08, 0.2}) {
+            const int height = dimensions.first;
+            const int width = dimensions.second;
+
+            minesweeper::FastRandom scanlineRandom(height * 1'000 + width);
+            minesweeper::FastRandom bitboardRandom(height * 1'000 + width);
+            minesweeper::Game scanlineGame(height, width, proportionOfMines, &scanlineRandom,
+                                           minesweeper::RevealEngine::SCANLINE);
+            minesweeper::Game bitboardGame(height, width, proportionOfMines, &bitboardRandom,
+                                           minesweeper::RevealEngine::BITBOARD);
+
+            minesweeper::FastRandom actionRandom(2021);
+            auto randomX = [&actionRandom, width] { return static_cast<int>(actionRandom.uniformInt(width - 1)); };
+            auto randomY = [&actionRandom, height] { return static_cast<int>(actionRandom.uniformInt(height - 1)); };
+
+            const int firstX = randomX();
+            const int firstY = randomY();
+            scanlineGame.createMinesAndNums(firstX, firstY);
+            bitboardGame.createMinesAndNums(firstX, firstY);
+
+            // marks block openings
+            for (int i = 0; i < height * width / 50; ++i) {
+                const int x = randomX();
+                const int y = randomY();
+                if (!(x == firstX && y == firstY)) {
+                    scanlineGame.markInputCoordinates(x, y);
+                    bitboardGame.markInputCoordinates(x, y);
+                }
+            }
+
+            scanlineGame.checkInputCoordinates(firstX, firstY);
+            bitboardGame.checkInputCoordinates(firstX, firstY);
+            ASSERT_EQ(scanlineGame.visualise<std::vector<minesweeper::VisualMinesweeperCell>>(),
+                      bitboardGame.visualise<std::vector<minesweeper::VisualMinesweeperCell>>())
+                << height << "x" << width << ", proportion of mines: " << proportionOfMines;
+
+            // further checks and completions around cells, until the game is over (or enough has been played)
+            for (int move = 0; move < 300 && !scanlineGame.playerHasWon() && !scanlineGame.playerHasLost(); ++move) {
+                const int x = randomX();
+                const int y = randomY();
+                if (scanlineGame.isCellMarked(x, y)) {
+                    scanlineGame.markInputCoordinates(x, y);
+                    bitboardGame.markInputCoordinates(x, y);
+                } else if (scanlineGame.isCellVisible(x, y)) {
+                    scanlineGame.completeAroundInputCoordinates(x, y);
+                    bitboardGame.completeAroundInputCoordinates(x, y);
+                } else {
+                    scanlineGame.checkInputCoordinates(x, y);
+                    bitboardGame.checkInputCoordinates(x, y);
+                }
+
+                ASSERT_EQ(scanlineGame.visualise<std::vector<minesweeper::VisualMinesweeperCell>>(),
+                          bitboardGame.visualise<std::vector<minesweeper::VisualMinesweeperCell>>())
+                    << height << "x" << width << ", proportion of mines: " << proportionOfMines;
+                ASSERT_EQ(scanlineGame.playerHasWon(), bitboardGame.playerHasWon());
+                ASSERT_EQ(scanlineGame.playerHasLost(), bitboardGame.playerHasLost());
+            }
+        }
+    }
+}
+
+TEST_F(MinesweeperGameTest, CellChangesTest) {
+
+    // changes have to match the difference between visualisations before and after every move
+    for (const minesweeper::RevealEngine revealEngine :
+         {minesweeper::RevealEngine::SCANLINE, minesweeper::RevealEngine::BITBOARD}) {
+        const int height = 30;
+        const int width = 70;
+
+        minesweeper::FastRandom gameRandom(2021);
+        minesweeper::Game game(height, width, 0.1, &gameRandom, revealEngine);
+
+        minesweeper::FastRandom actionRandom(2022);
+        std::vector<minesweeper::CellChange> changes;
+        std::vector<minesweeper::VisualMinesweeperCell> visualisation =
+            game.visualise<std::vector<minesweeper::VisualMinesweeperCell>>();
+
+        for (int move = 0; move < 300 && !game.playerHasWon() && !game.playerHasLost(); ++move) {
+            const int x = static_cast<int>(actionRandom.uniformInt(width - 1));
+            const int y = static_cast<int>(actionRandom.uniformInt(height - 1));
+            if (move % 5 == 4) {
+                game.markInputCoordinates(x, y, changes);
+            } else if (game.isCellVisible(x, y)) {
+                game.completeAroundInputCoordinates(x, y, changes);
+            } else {
+                game.checkInputCoordinates(x, y, changes);
+            }
+
+            const auto newVisualisation = game.visualise<std::vector<minesweeper::VisualMinesweeperCell>>();
+            std::vector<minesweeper::CellChange> expectedChanges;
+            for (int i = 0; i < height * width; ++i) {
+                if (visualisation[i] != newVisualisation[i]) {
+                    expectedChanges.push_back(minesweeper::CellChange{i % width, i / width, newVisualisation[i]});
+                }
+            }
+
+            std::vector<minesweeper::CellChange> sortedChanges(changes);
+            std::sort(sortedChanges.begin(), sortedChanges.end(),
+                      [](const minesweeper::CellChange& first, const minesweeper::CellChange& second) {
+                          return std::make_pair(first.y, first.x) < std::make_pair(second.y, second.x);
+                      });
+            ASSERT_EQ(sortedChanges, expectedChanges) << "move: " << move;
+
+            visualisation = newVisualisation;
+        }
+    }
+
+    // previous contents are replaced, also when the move is not done
+    minesweeper::Game game(10, 12, &myRandom);
+    std::vector<minesweeper::CellChange> changes{
+        minesweeper::CellChange{0, 0, minesweeper::VisualMinesweeperCell::EMPTY}};
+    EXPECT_THROW(game.checkInputCoordinates(12, 0, changes), std::out_of_range);
+    EXPECT_TRUE(changes.empty());
+    game.checkInputCoordinates(5, 5, changes);
+    EXPECT_FALSE(changes.empty());
+    game.markInputCoordinates(5, 5, changes); // visible cells can not be marked
+    EXPECT_TRUE(changes.empty());
+
+    // moves without change-set do not touch previous change-set
+    changes.push_back(minesweeper::CellChange{0, 0, minesweeper::VisualMinesweeperCell::EMPTY});
+    game.completeAroundInputCoordinates(5, 5);
+    EXPECT_EQ(changes.size(), 1u);
+}
+
 TEST_F(MinesweeperGameTest, MarkInputCoordinatesTest) {
 
     // negative x and y
@@ -2500,6 +2821,780 @@ TEST_F(MinesweeperGameTest, SerialiseTest) {
     EXPECT_EQ(simpleStartedGameStr, startedFiveBySixGameStr);
 }
 
+TEST_F(MinesweeperGameTest, SerialiseCompactTest) {
+
+    // removes whitespace outside of JSON strings
+    auto compactJson = [](const std::string& json) {
+        std::string output;
+        bool isInString = false;
+        for (std::size_t i = 0; i < json.size(); ++i) {
+            if (isInString) {
+                output += json[i];
+                if (json[i] == '\\') {
+                    output += json[++i];
+                } else if (json[i] == '"') {
+                    isInString = false;
+                }
+            } else if (json[i] != ' ' && json[i] != '\n') {
+                output += json[i];
+                isInString = json[i] == '"';
+            }
+        }
+        return output + '\n';
+    };
+
+    auto serialiseCompactToString = [](const minesweeper::Game& game) {
+        std::ostringstream oss;
+        game.serialise(oss, minesweeper::SerialisationFormat::COMPACT_JSON);
+        return oss.str();
+    };
+
+    // compact serialisations of the saved games
+    for (const std::string& gameStr : {startedFiveBySixGameStr, markedWinFiveByFourGameStr, lossFiveByThreeGameStr,
+                                       unfinishedSevenBySevenGameStr, invalidMarkAndLossNineByFiveGameStr}) {
+        minesweeper::Game game;
+        std::istringstream iss(gameStr);
+        game.deserialise(iss);
+        EXPECT_EQ(serialiseToString(game), gameStr);
+        EXPECT_EQ(serialiseCompactToString(game), compactJson(gameStr));
+    }
+
+    minesweeper::Game emptyGame(0, 0, &myRandom);
+    EXPECT_EQ(serialiseCompactToString(emptyGame), compactJson(serialiseToString(emptyGame)));
+
+    // compact serialisation of a larger game loads into an identical game
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game largeGame(70, 130, 0.1, &fastRandom);
+    largeGame.checkInputCoordinates(65, 35);
+    largeGame.markInputCoordinates(0, 0);
+    const std::string largeGameStr = serialiseToString(largeGame);
+    const std::string largeGameCompactStr = serialiseCompactToString(largeGame);
+    EXPECT_EQ(largeGameCompactStr, compactJson(largeGameStr));
+
+    minesweeper::Game largeGameCopy;
+    std::istringstream iss(largeGameCompactStr);
+    largeGameCopy.deserialise(iss);
+    EXPECT_EQ(serialiseToString(largeGameCopy), largeGameStr);
+}
+
+TEST_F(MinesweeperGameTest, SerialiseBinaryTest) {
+
+    auto serialiseBinaryToString = [](const minesweeper::Game& game) {
+        std::ostringstream oss;
+        game.serialise(oss, minesweeper::SerialisationFormat::BINARY);
+        return oss.str();
+    };
+
+    // binary serialisations load into identical games (numbers of mines around are recounted)
+    for (const std::string& gameStr : {startedFiveBySixGameStr, startedSixByEightGameStr, markedWinFiveByFourGameStr,
+                                       lossFiveByThreeGameStr, checkedWinFourByEightGameStr,
+                                       unfinishedSevenBySevenGameStr, invalidMarkAndLossNineByFiveGameStr}) {
+        minesweeper::Game game;
+        std::istringstream iss(gameStr);
+        game.deserialise(iss);
+
+        minesweeper::Game gameCopy;
+        std::istringstream binaryStream(serialiseBinaryToString(game));
+        gameCopy.deserialise(binaryStream);
+        EXPECT_EQ(serialiseToString(gameCopy), gameStr);
+    }
+
+    minesweeper::Game emptyGame(0, 0, &myRandom);
+    minesweeper::Game emptyGameCopy(3, 4, 0, &myRandom);
+    std::istringstream emptyGameStream(serialiseBinaryToString(emptyGame));
+    emptyGameCopy.deserialise(emptyGameStream);
+    EXPECT_EQ(serialiseToString(emptyGameCopy), serialiseToString(emptyGame));
+
+    // larger game (with grid width not a multiple of 64), followed by another serialisation in the same stream
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game largeGame(70, 130, 0.1, &fastRandom);
+    largeGame.checkInputCoordinates(65, 35);
+    largeGame.markInputCoordinates(0, 0);
+    const std::string largeGameBinaryStr = serialiseBinaryToString(largeGame);
+    EXPECT_LT(largeGameBinaryStr.size() * 100, serialiseToString(largeGame).size());
+
+    minesweeper::Game largeGameCopy;
+    std::istringstream largeGameStream(largeGameBinaryStr + startedFiveBySixGameStr);
+    largeGameCopy.deserialise(largeGameStream);
+    EXPECT_EQ(serialiseToString(largeGameCopy), serialiseToString(largeGame));
+    largeGameCopy.deserialise(largeGameStream);
+    EXPECT_EQ(serialiseToString(largeGameCopy), startedFiveBySixGameStr);
+
+    // any changed byte in the header or in the cells is detected, and leaves game unchanged
+    for (std::size_t i = 1; i < largeGameBinaryStr.size(); i += 97) {
+        std::string corruptedStr = largeGameBinaryStr;
+        corruptedStr[i] = static_cast<char>(corruptedStr[i] ^ 0x10);
+
+        minesweeper::Game game;
+        std::istringstream startedGameStream(startedFiveBySixGameStr);
+        game.deserialise(startedGameStream);
+
+        std::istringstream corruptedStream(corruptedStr);
+        EXPECT_THROW(game.deserialise(corruptedStream), std::invalid_argument) << "byte: " << i;
+        EXPECT_EQ(serialiseToString(game), startedFiveBySixGameStr) << "byte: " << i;
+    }
+
+    // truncated serialisations
+    for (const std::size_t size : {std::size_t{1}, std::size_t{39}, std::size_t{40}, largeGameBinaryStr.size() - 1}) {
+        minesweeper::Game game;
+        std::istringstream truncatedStream(largeGameBinaryStr.substr(0, size));
+        EXPECT_THROW(game.deserialise(truncatedStream), std::invalid_argument) << "size: " << size;
+    }
+}
+
+TEST_F(MinesweeperGameTest, SerialiseSeedBasedTest) {
+
+    auto serialiseSeedBasedToString = [](const minesweeper::Game& game) {
+        std::ostringstream oss;
+        game.serialise(oss, minesweeper::SerialisationFormat::SEED_BASED);
+        return oss.str();
+    };
+
+    // same seed and first checked cell give same mine layout, regardless of 'IRandom' of the game
+    minesweeper::Game seededGame(70, 130, 0.1, &myRandom);
+    seededGame.setGenerationSeed(2021);
+    seededGame.checkInputCoordinates(65, 35);
+    seededGame.markInputCoordinates(0, 0);
+    seededGame.markInputCoordinates(129, 69);
+
+    minesweeper::FastRandom fastRandom(7);
+    minesweeper::Game otherSeededGame(70, 130, 0.1, &fastRandom);
+    otherSeededGame.setGenerationSeed(2021);
+    otherSeededGame.checkInputCoordinates(65, 35);
+    otherSeededGame.markInputCoordinates(0, 0);
+    otherSeededGame.markInputCoordinates(129, 69);
+    EXPECT_EQ(serialiseToString(otherSeededGame), serialiseToString(seededGame));
+
+    // seed-based serialisations are much smaller than bit plane ones and load into identical games
+    const std::string seededGameStr = serialiseSeedBasedToString(seededGame);
+    std::ostringstream binaryStream;
+    seededGame.serialise(binaryStream, minesweeper::SerialisationFormat::BINARY);
+    EXPECT_LT(seededGameStr.size() * 5, binaryStream.str().size());
+
+    minesweeper::Game seededGameCopy;
+    std::istringstream seededGameStream(seededGameStr + startedFiveBySixGameStr);
+    seededGameCopy.deserialise(seededGameStream);
+    EXPECT_EQ(serialiseToString(seededGameCopy), serialiseToString(seededGame));
+    EXPECT_EQ(serialiseSeedBasedToString(seededGameCopy), seededGameStr);
+    seededGameCopy.deserialise(seededGameStream);
+    EXPECT_EQ(serialiseToString(seededGameCopy), startedFiveBySixGameStr);
+
+    // games without mines can be serialised, but games with mines not created from a seed can not
+    minesweeper::Game newGame(5, 6, 5, &myRandom);
+    minesweeper::Game newGameCopy;
+    std::istringstream newGameStream(serialiseSeedBasedToString(newGame));
+    newGameCopy.deserialise(newGameStream);
+    EXPECT_EQ(serialiseToString(newGameCopy), serialiseToString(newGame));
+
+    minesweeper::Game unseededGame(5, 6, 5, &myRandom);
+    unseededGame.checkInputCoordinates(2, 2);
+    std::ostringstream unseededStream;
+    EXPECT_THROW(unseededGame.serialise(unseededStream, minesweeper::SerialisationFormat::SEED_BASED),
+                 std::invalid_argument);
+
+    // generation seed is kept over new games, but not after clearing it
+    seededGame.newGame(70, 130, 0.1);
+    seededGame.checkInputCoordinates(65, 35);
+    seededGame.markInputCoordinates(0, 0);
+    seededGame.markInputCoordinates(129, 69);
+    EXPECT_EQ(serialiseToString(seededGame), serialiseToString(otherSeededGame));
+    EXPECT_TRUE(seededGame.hasGenerationSeed());
+    EXPECT_EQ(seededGame.getGenerationSeed(), 2021U);
+    seededGame.clearGenerationSeed();
+    EXPECT_FALSE(seededGame.hasGenerationSeed());
+
+    // any changed byte is detected, and leaves game unchanged
+    for (std::size_t i = 1; i < seededGameStr.size(); i += 7) {
+        std::string corruptedStr = seededGameStr;
+        corruptedStr[i] = static_cast<char>(corruptedStr[i] ^ 0x10);
+
+        minesweeper::Game game;
+        std::istringstream startedGameStream(startedFiveBySixGameStr);
+        game.deserialise(startedGameStream);
+
+        std::istringstream corruptedStream(corruptedStr);
+        EXPECT_THROW(game.deserialise(corruptedStream), std::invalid_argument) << "byte: " << i;
+        EXPECT_EQ(serialiseToString(game), startedFiveBySixGameStr) << "byte: " << i;
+    }
+
+    // truncated serialisations
+    for (const std::size_t size : {std::size_t{40}, std::size_t{59}, std::size_t{60}, seededGameStr.size() - 1}) {
+        minesweeper::Game game;
+        std::istringstream truncatedStream(seededGameStr.substr(0, size));
+        EXPECT_THROW(game.deserialise(truncatedStream), std::invalid_argument) << "size: " << size;
+    }
+}
+
+TEST_F(MinesweeperGameTest, SerialiseIntoMemoryTest) {
+
+    minesweeper::Game seededGame(70, 130, 0.1, &myRandom);
+    seededGame.setGenerationSeed(2021);
+    seededGame.checkInputCoordinates(65, 35);
+    seededGame.markInputCoordinates(0, 0);
+
+    for (const minesweeper::SerialisationFormat format :
+         {minesweeper::SerialisationFormat::JSON, minesweeper::SerialisationFormat::COMPACT_JSON,
+          minesweeper::SerialisationFormat::BINARY, minesweeper::SerialisationFormat::SEED_BASED}) {
+        std::ostringstream oss;
+        seededGame.serialise(oss, format);
+        const std::string serialisation = oss.str();
+
+        // size query and memory serialisation match stream serialisation
+        const std::size_t size = seededGame.serialisationSize(format);
+        EXPECT_EQ(size, serialisation.size());
+
+        std::vector<char> memory(size + startedFiveBySixGameStr.size());
+        EXPECT_EQ(seededGame.serialise(memory.data(), size, format), size);
+        EXPECT_EQ(std::string(memory.data(), size), serialisation);
+
+        // too small memory throws
+        std::vector<char> smallMemory(size - 1);
+        EXPECT_THROW(seededGame.serialise(smallMemory.data(), smallMemory.size(), format), std::invalid_argument);
+
+        // deserialisation reads only its own bytes, so that serialisations can follow each other in memory
+        std::copy(startedFiveBySixGameStr.begin(), startedFiveBySixGameStr.end(), memory.begin() + size);
+        minesweeper::Game gameCopy;
+        EXPECT_EQ(gameCopy.deserialise(memory.data(), memory.size()), size);
+        EXPECT_EQ(serialiseToString(gameCopy), serialiseToString(seededGame));
+
+        EXPECT_EQ(gameCopy.deserialise(memory.data() + size, memory.size() - size), startedFiveBySixGameStr.size());
+        EXPECT_EQ(serialiseToString(gameCopy), startedFiveBySixGameStr);
+
+        // truncated memory throws and leaves game unchanged
+        EXPECT_THROW(gameCopy.deserialise(memory.data(), size / 2), std::invalid_argument);
+        EXPECT_EQ(serialiseToString(gameCopy), startedFiveBySixGameStr);
+    }
+
+    minesweeper::Game emptyInputGame;
+    EXPECT_THROW(emptyInputGame.deserialise(nullptr, 0), std::invalid_argument);
+}
+
+TEST_F(MinesweeperGameTest, DeltaTest) {
+
+    auto serialiseBinaryToString = [](const minesweeper::Game& game) {
+        std::ostringstream oss;
+        game.serialise(oss, minesweeper::SerialisationFormat::BINARY);
+        return oss.str();
+    };
+    auto serialiseDeltaToString = [](const minesweeper::Game& game) {
+        std::ostringstream oss;
+        game.serialiseDelta(oss);
+        return oss.str();
+    };
+
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game game(70, 130, 0.1, &fastRandom);
+    game.checkInputCoordinates(65, 35);
+
+    // full save and checkpoint, followed by deltas of a few moves
+    const std::string baseStr = serialiseBinaryToString(game);
+    game.checkpoint();
+    game.markInputCoordinates(0, 0);
+    game.markInputCoordinates(129, 69);
+    const std::string firstDeltaStr = serialiseDeltaToString(game);
+    const std::string firstGameStr = serialiseToString(game);
+    EXPECT_LT(firstDeltaStr.size() * 20, baseStr.size());
+
+    game.checkpoint();
+    game.markInputCoordinates(0, 0);
+    game.checkInputCoordinates(0, 0);
+    game.checkInputCoordinates(1, 69);
+    const std::string secondDeltaStr = serialiseDeltaToString(game);
+
+    // deltas apply to the saved game in order
+    minesweeper::Game loadedGame;
+    std::istringstream baseStream(baseStr);
+    loadedGame.deserialise(baseStream);
+    std::istringstream firstDeltaStream(firstDeltaStr);
+    loadedGame.applyDelta(firstDeltaStream);
+    EXPECT_EQ(serialiseToString(loadedGame), firstGameStr);
+    EXPECT_EQ(loadedGame.applyDelta(secondDeltaStr.data(), secondDeltaStr.size()), secondDeltaStr.size());
+    EXPECT_EQ(serialiseToString(loadedGame), serialiseToString(game));
+
+    // save followed by a chain of deltas is compacted into a single save
+    std::istringstream chainStream(baseStr + firstDeltaStr + secondDeltaStr);
+    std::ostringstream compactedStream;
+    minesweeper::Game::compactDeltas(chainStream, compactedStream);
+    EXPECT_EQ(compactedStream.str(), serialiseBinaryToString(game));
+
+    std::istringstream jsonChainStream(serialiseToString(game) + secondDeltaStr);
+    std::ostringstream compactedJsonStream;
+    minesweeper::Game::compactDeltas(jsonChainStream, compactedJsonStream, minesweeper::SerialisationFormat::JSON);
+    EXPECT_EQ(compactedJsonStream.str(), serialiseToString(game));
+
+    // without a checkpoint (since loading), or after a reset, delta holds the whole grid
+    minesweeper::Game uncheckpointedGame;
+    std::istringstream gameStream(serialiseToString(game));
+    uncheckpointedGame.deserialise(gameStream);
+    minesweeper::Game emptyGame;
+    std::istringstream fullDeltaStream(serialiseDeltaToString(uncheckpointedGame));
+    emptyGame.applyDelta(fullDeltaStream);
+    EXPECT_EQ(serialiseToString(emptyGame), serialiseToString(game));
+
+    game.checkpoint();
+    game.reset();
+    game.checkInputCoordinates(10, 10);
+    std::istringstream resetDeltaStream(serialiseDeltaToString(game));
+    loadedGame.applyDelta(resetDeltaStream);
+    EXPECT_EQ(serialiseToString(loadedGame), serialiseToString(game));
+
+    // deltas do not apply to other games, which are left unchanged
+    minesweeper::Game otherGame;
+    std::istringstream otherGameStream(startedFiveBySixGameStr);
+    otherGame.deserialise(otherGameStream);
+    std::istringstream otherDeltaStream(firstDeltaStr);
+    EXPECT_THROW(otherGame.applyDelta(otherDeltaStream), std::invalid_argument);
+    EXPECT_EQ(serialiseToString(otherGame), startedFiveBySixGameStr);
+
+    // any changed byte is detected
+    for (std::size_t i = 1; i < firstDeltaStr.size(); i += 3) {
+        std::string corruptedStr = firstDeltaStr;
+        corruptedStr[i] = static_cast<char>(corruptedStr[i] ^ 0x10);
+
+        minesweeper::Game baseGame;
+        std::istringstream baseGameStream(baseStr);
+        baseGame.deserialise(baseGameStream);
+
+        std::istringstream corruptedStream(corruptedStr);
+        EXPECT_THROW(baseGame.applyDelta(corruptedStream), std::invalid_argument) << "byte: " << i;
+        EXPECT_EQ(serialiseBinaryToString(baseGame), baseStr) << "byte: " << i;
+    }
+
+    // undone reveals hide cells again, which only a full delta holds
+    minesweeper::Game journalledGame(30, 40, 0.1, &fastRandom);
+    journalledGame.enableMoveJournal();
+    journalledGame.checkInputCoordinates(20, 15);
+    const std::string journalledBaseStr = serialiseBinaryToString(journalledGame);
+    journalledGame.checkpoint();
+    ASSERT_FALSE(journalledGame.isCellVisible(39, 29));
+    journalledGame.checkInputCoordinates(39, 29);
+    const std::string revealDeltaStr = serialiseDeltaToString(journalledGame);
+    journalledGame.checkpoint();
+    journalledGame.undoMove();
+    const std::string undoDeltaStr = serialiseDeltaToString(journalledGame);
+    journalledGame.checkpoint();
+    journalledGame.redoMove();
+    const std::string redoDeltaStr = serialiseDeltaToString(journalledGame);
+
+    minesweeper::Game journalledLoadedGame;
+    std::istringstream journalledChainStream(journalledBaseStr + revealDeltaStr + undoDeltaStr + redoDeltaStr);
+    journalledLoadedGame.deserialise(journalledChainStream);
+    journalledLoadedGame.applyDelta(journalledChainStream);
+    journalledLoadedGame.applyDelta(journalledChainStream);
+    EXPECT_FALSE(journalledLoadedGame.isCellVisible(39, 29));
+    journalledLoadedGame.applyDelta(journalledChainStream);
+    EXPECT_EQ(serialiseToString(journalledLoadedGame), serialiseToString(journalledGame));
+}
+
+TEST_F(MinesweeperGameTest, MoveJournalTest) {
+
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game game(70, 130, 0.1, &fastRandom);
+    EXPECT_FALSE(game.isMoveJournalEnabled());
+    game.enableMoveJournal();
+    EXPECT_TRUE(game.isMoveJournalEnabled());
+    EXPECT_FALSE(game.canUndoMove());
+    EXPECT_THROW(game.undoMove(), std::out_of_range);
+    EXPECT_THROW(game.redoMove(), std::out_of_range);
+
+    // moves, and games after each of them
+    std::vector<std::string> gameStrs;
+    game.checkInputCoordinates(65, 35);
+    gameStrs.push_back(serialiseToString(game));
+    game.markInputCoordinates(0, 0);
+    gameStrs.push_back(serialiseToString(game));
+    game.checkInputCoordinates(1, 69);
+    gameStrs.push_back(serialiseToString(game));
+    game.markInputCoordinates(0, 0);
+    gameStrs.push_back(serialiseToString(game));
+
+    // moves which change nothing are not journalled
+    game.checkInputCoordinates(65, 35);
+
+    // undoing and redoing moves (changed cells are reported like for moves)
+    std::vector<minesweeper::CellChange> changes;
+    game.undoMove(changes);
+    EXPECT_EQ(serialiseToString(game), gameStrs[2]);
+    ASSERT_EQ(changes.size(), 1U);
+    EXPECT_EQ(changes[0], (minesweeper::CellChange{0, 0, minesweeper::VisualMinesweeperCell::MARKED}));
+    game.undoMove();
+    game.undoMove();
+    EXPECT_EQ(serialiseToString(game), gameStrs[0]);
+    EXPECT_TRUE(game.canRedoMove());
+    game.redoMove();
+    EXPECT_EQ(serialiseToString(game), gameStrs[1]);
+    game.redoMove();
+    game.redoMove();
+    EXPECT_EQ(serialiseToString(game), gameStrs[3]);
+    EXPECT_FALSE(game.canRedoMove());
+
+    // undoing the first check keeps its mines, but hides all cells
+    while (game.canUndoMove()) {
+        game.undoMove();
+    }
+    const auto visualisation = game.visualise<std::vector<minesweeper::VisualMinesweeperCell>>();
+    EXPECT_EQ(std::count(visualisation.begin(), visualisation.end(), minesweeper::VisualMinesweeperCell::UNCHECKED),
+              70 * 130);
+    game.redoMove();
+    EXPECT_EQ(serialiseToString(game), gameStrs[0]);
+
+    // copies have their own journals, and a new move drops moves which could have been redone
+    minesweeper::Game gameCopy(game);
+    game.markInputCoordinates(0, 0);
+    EXPECT_FALSE(game.canRedoMove());
+    EXPECT_TRUE(gameCopy.canRedoMove());
+    gameCopy.redoMove();
+    EXPECT_EQ(serialiseToString(gameCopy), gameStrs[1]);
+
+    // journal is cleared on reset, and kept only while enabled
+    game.reset();
+    EXPECT_FALSE(game.canUndoMove());
+    gameCopy.disableMoveJournal();
+    EXPECT_FALSE(gameCopy.canUndoMove());
+    EXPECT_THROW(gameCopy.undoMove(), std::out_of_range);
+}
+
+TEST_F(MinesweeperGameTest, ForkedCopyTest) {
+
+    // grid tall enough to be split into several tiles of cells
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game game(100, 200, 0.1, &fastRandom);
+    game.checkInputCoordinates(100, 50);
+    const std::string gameStr = serialiseToString(game);
+    ASSERT_FALSE(game.isCellVisible(0, 0) || game.isCellVisible(199, 99) || game.isCellVisible(100, 0));
+
+    // copies share cells with the original until either of them changes them
+    minesweeper::Game fork(game);
+    minesweeper::Game forkOfFork(fork);
+    fork.markInputCoordinates(0, 0);
+    fork.markInputCoordinates(199, 99);
+    EXPECT_EQ(serialiseToString(game), gameStr);
+    EXPECT_EQ(serialiseToString(forkOfFork), gameStr);
+    EXPECT_TRUE(fork.isCellMarked(0, 0));
+    EXPECT_TRUE(fork.isCellMarked(199, 99));
+    EXPECT_FALSE(game.isCellMarked(0, 0));
+
+    // changes made to the original after copying are not seen by copies
+    game.markInputCoordinates(100, 0);
+    game.checkInputCoordinates(0, 99);
+    EXPECT_FALSE(fork.isCellMarked(100, 0));
+    EXPECT_EQ(serialiseToString(forkOfFork), gameStr);
+    EXPECT_EQ(fork.isCellVisible(0, 99), forkOfFork.isCellVisible(0, 99));
+
+    // assigned and reset copies
+    minesweeper::Game assigned;
+    assigned = fork;
+    assigned.reset(true);
+    EXPECT_TRUE(fork.isCellMarked(0, 0));
+    EXPECT_FALSE(assigned.isCellMarked(0, 0));
+    EXPECT_FALSE(assigned.isCellVisible(100, 50));
+    forkOfFork.markInputCoordinates(0, 0);
+    forkOfFork.markInputCoordinates(0, 0);
+    EXPECT_EQ(serialiseToString(forkOfFork), gameStr);
+}
+
+TEST_F(MinesweeperGameTest, ActionLogTest) {
+
+    // recording moves of a seeded game
+    minesweeper::ActionLog log;
+    minesweeper::Game game(16, 30, 99);
+    game.setGenerationSeed(2021);
+    game.enableMoveJournal();
+    game.recordActions(&log);
+    ASSERT_TRUE(game.isRecordingActions());
+    game.checkInputCoordinates(15, 8);
+    game.completeAroundInputCoordinates(15, 8);
+    game.markInputCoordinates(0, 0);
+    game.undoMove();
+    game.redoMove();
+    game.reset(true);
+    game.checkInputCoordinates(3, 3);
+    game.newGame(9, 9, 10);
+    game.checkInputCoordinates(4, 4);
+    EXPECT_THROW(game.markInputCoordinates(9, 9), std::out_of_range); // (invalid moves are not recorded)
+    ASSERT_EQ(log.numOfActions(), 9u);
+    EXPECT_EQ(log.getActions()[0].type, minesweeper::ActionType::CHECK);
+    EXPECT_EQ(log.getActions()[3].type, minesweeper::ActionType::UNDO);
+    EXPECT_EQ(log.getActions()[5].type, minesweeper::ActionType::RESET);
+    EXPECT_TRUE(log.getActions()[5].keepCreatedMines);
+    EXPECT_EQ(log.getActions()[7].type, minesweeper::ActionType::NEW_GAME);
+    EXPECT_EQ(log.getActions()[7].numOfMines, 10);
+    EXPECT_EQ(log.getGridHeight(), 16);
+    EXPECT_EQ(log.getGenerationSeed(), 2021u);
+
+    // recording has to start before mines are created
+    EXPECT_THROW(game.recordActions(&log), std::invalid_argument);
+    game.recordActions(nullptr);
+    EXPECT_FALSE(game.isRecordingActions());
+
+    // saved and loaded log replays the same game
+    std::stringstream logStream;
+    log.serialise(logStream);
+    const std::string savedLog = logStream.str();
+    EXPECT_EQ(savedLog.size(), log.serialisationSize());
+    minesweeper::ActionLog loadedLog;
+    loadedLog.deserialise(logStream);
+    ASSERT_EQ(loadedLog.numOfActions(), log.numOfActions());
+    minesweeper::Game replayedGame;
+    loadedLog.replay(replayedGame);
+    EXPECT_EQ(serialiseToString(replayedGame), serialiseToString(game));
+    replayedGame.undoMove();
+    EXPECT_FALSE(replayedGame.isCellVisible(4, 4));
+
+    // invalid logs are not loaded
+    std::string corruptedLog = savedLog;
+    corruptedLog[40] ^= 1;
+    std::istringstream corruptedStream(corruptedLog);
+    EXPECT_THROW(loadedLog.deserialise(corruptedStream), std::invalid_argument);
+    std::istringstream truncatedStream(savedLog.substr(0, savedLog.size() - 1));
+    EXPECT_THROW(loadedLog.deserialise(truncatedStream), std::invalid_argument);
+    std::istringstream notLogStream(serialiseToString(game));
+    EXPECT_THROW(loadedLog.deserialise(notLogStream), std::invalid_argument);
+    EXPECT_EQ(loadedLog.numOfActions(), log.numOfActions());
+
+    // log of unseeded game replays with 'IRandom' in the same state
+    minesweeper::FastRandom recordingRandom(7);
+    minesweeper::FastRandom replayingRandom(7);
+    minesweeper::ActionLog unseededLog;
+    minesweeper::Game unseededGame(20, 20, 50, &recordingRandom);
+    unseededGame.recordActions(&unseededLog);
+    unseededGame.checkInputCoordinates(10, 10);
+    unseededGame.markInputCoordinates(0, 19);
+    EXPECT_FALSE(unseededLog.hasGenerationSeed());
+    minesweeper::Game unseededReplay(1, 1, 0, &replayingRandom);
+    unseededLog.replay(unseededReplay);
+    EXPECT_EQ(serialiseToString(unseededReplay), serialiseToString(unseededGame));
+
+    // seed set after recording has started is logged, until recorded actions have created mines
+    minesweeper::ActionLog lateSeededLog;
+    minesweeper::Game lateSeededGame(20, 20, 50, &recordingRandom);
+    lateSeededGame.recordActions(&lateSeededLog);
+    lateSeededGame.clearGenerationSeed();
+    lateSeededGame.setGenerationSeed(2022);
+    lateSeededGame.checkInputCoordinates(10, 10);
+    EXPECT_TRUE(lateSeededLog.hasGenerationSeed());
+    EXPECT_EQ(lateSeededLog.getGenerationSeed(), 2022u);
+    EXPECT_THROW(lateSeededGame.setGenerationSeed(2023), std::invalid_argument);
+    EXPECT_THROW(lateSeededGame.clearGenerationSeed(), std::invalid_argument);
+    EXPECT_EQ(lateSeededGame.getGenerationSeed(), 2022u);
+    minesweeper::Game lateSeededReplay;
+    lateSeededLog.replay(lateSeededReplay);
+    EXPECT_EQ(serialiseToString(lateSeededReplay), serialiseToString(lateSeededGame));
+
+    // parallel replay of many logs
+    const std::size_t numOfLogs = 100;
+    std::vector<minesweeper::ActionLog> logs(numOfLogs);
+    std::vector<std::string> recordedGames;
+    for (std::size_t i = 0; i < numOfLogs; ++i) {
+        minesweeper::Game recordedGame(16, 30, 99);
+        recordedGame.setGenerationSeed(i);
+        recordedGame.recordActions(&logs[i]);
+        recordedGame.checkInputCoordinates(static_cast<int>(i % 30), static_cast<int>(i % 16));
+        recordedGame.markInputCoordinates(29, 15);
+        recordedGames.push_back(serialiseToString(recordedGame));
+    }
+    std::vector<std::string> replayedGames(numOfLogs);
+    minesweeper::ActionLog::replay(
+        logs,
+        [&replayedGames](std::size_t logIndex, const minesweeper::Game& replayed) {
+            std::ostringstream oss;
+            replayed.serialise(oss);
+            replayedGames[logIndex] = oss.str();
+        },
+        4);
+    EXPECT_EQ(replayedGames, recordedGames);
+
+    // logs without a seed can not be replayed in parallel
+    logs.push_back(unseededLog);
+    EXPECT_THROW(minesweeper::ActionLog::replay(logs, [](std::size_t, const minesweeper::Game&) {}),
+                 std::invalid_argument);
+}
+
+TEST_F(MinesweeperGameTest, StatsTest) {
+
+    auto allStatsAreZero = [](const minesweeper::GameStats& stats) {
+        return stats.numOfCellsRevealed == 0 && stats.numOfOpeningSeedsPushed == 0 &&
+               stats.numOfOpeningSeedsPopped == 0 && stats.numOfDuplicateOpeningSeeds == 0 &&
+               stats.numOfNeighbourLookups == 0 && stats.numOfMineGenerations == 0 &&
+               stats.mineGenerationNanoseconds == 0 && stats.numOfBytesSerialised == 0;
+    };
+
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game game(30, 40, 0.05, &fastRandom);
+    EXPECT_TRUE(allStatsAreZero(game.stats()));
+
+    game.checkInputCoordinates(20, 15);
+    game.completeAroundInputCoordinates(20, 15);
+    std::ostringstream oss;
+    game.serialise(oss, minesweeper::SerialisationFormat::BINARY);
+    game.serialise(oss, minesweeper::SerialisationFormat::COMPACT_JSON);
+    const minesweeper::GameStats stats = game.stats();
+
+    // statistics compile away, unless they are enabled
+    if (!minesweeper::Game::statsAreEnabled()) {
+        EXPECT_TRUE(allStatsAreZero(stats));
+        return;
+    }
+
+    std::uint64_t numOfVisibleCells = 0;
+    for (int y = 0; y < game.getGridHeight(); ++y) {
+        for (int x = 0; x < game.getGridWidth(); ++x) {
+            numOfVisibleCells += game.isCellVisible(x, y) ? 1 : 0;
+        }
+    }
+    ASSERT_GT(numOfVisibleCells, 9u);
+    EXPECT_EQ(stats.numOfCellsRevealed, numOfVisibleCells);
+    EXPECT_GT(stats.numOfOpeningSeedsPushed, 0u);
+    EXPECT_EQ(stats.numOfOpeningSeedsPopped, stats.numOfOpeningSeedsPushed);
+    EXPECT_LT(stats.numOfDuplicateOpeningSeeds, stats.numOfOpeningSeedsPopped);
+    // (marks and cells around the completed cell)
+    EXPECT_GE(stats.numOfNeighbourLookups, 16u);
+    EXPECT_EQ(stats.numOfMineGenerations, 1u);
+    EXPECT_GT(stats.mineGenerationNanoseconds, 0u);
+    EXPECT_EQ(stats.numOfBytesSerialised, oss.str().size());
+
+    // counting the size of a serialisation is not a serialisation
+    game.serialisationSize(minesweeper::SerialisationFormat::JSON);
+    EXPECT_EQ(game.stats().numOfBytesSerialised, oss.str().size());
+
+    // nor is a serialisation, which has failed (mines have not been created from a seed)
+    std::ostringstream seedBasedStream;
+    EXPECT_THROW(game.serialise(seedBasedStream, minesweeper::SerialisationFormat::SEED_BASED),
+                 std::invalid_argument);
+    EXPECT_EQ(game.stats().numOfBytesSerialised, oss.str().size());
+
+    // const game can be serialised concurrently, and every serialisation is counted
+    const minesweeper::Game& constGame = game;
+    const std::size_t binarySize = constGame.serialisationSize(minesweeper::SerialisationFormat::BINARY);
+    const int numOfThreads = 4;
+    const int numOfSerialisationsPerThread = 50;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numOfThreads; ++i) {
+        threads.emplace_back([&constGame] {
+            for (int j = 0; j < numOfSerialisationsPerThread; ++j) {
+                std::ostringstream threadStream;
+                constGame.serialise(threadStream, minesweeper::SerialisationFormat::BINARY);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(game.stats().numOfBytesSerialised,
+              oss.str().size() + binarySize * numOfThreads * numOfSerialisationsPerThread);
+
+    // copies keep statistics, and resetting clears them
+    minesweeper::Game copy(game);
+    game.resetStats();
+    EXPECT_TRUE(allStatsAreZero(game.stats()));
+    EXPECT_EQ(copy.stats().numOfCellsRevealed, numOfVisibleCells);
+}
+
+TEST_F(MinesweeperGameTest, LatencyRecorderTest) {
+
+    using minesweeper::BoardSizeClass;
+    using minesweeper::LatencyHistogram;
+    using minesweeper::LatencyOperation;
+    using minesweeper::LatencyRecorder;
+
+    // buckets hold their latencies, and are less than 1/32 of their latencies wide
+    for (const std::uint64_t latency : {0ULL, 1ULL, 31ULL, 32ULL, 33ULL, 63ULL, 64ULL, 1'000ULL, 123'456'789ULL,
+                                        (1ULL << 47U) + 12'345ULL}) {
+        const int bucket = LatencyHistogram::bucketIndex(latency);
+        EXPECT_LE(LatencyHistogram::lowestValueOfBucket(bucket), latency);
+        EXPECT_GE(LatencyHistogram::highestValueOfBucket(bucket), latency);
+        EXPECT_LE((LatencyHistogram::highestValueOfBucket(bucket) - LatencyHistogram::lowestValueOfBucket(bucket)) * 32,
+                  latency);
+    }
+    EXPECT_EQ(LatencyHistogram::bucketIndex(1ULL << 63U), LatencyHistogram::NUM_OF_BUCKETS - 1);
+    EXPECT_THROW(LatencyHistogram::lowestValueOfBucket(LatencyHistogram::NUM_OF_BUCKETS), std::out_of_range);
+
+    // percentiles
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.valueAtPercentile(99), 0u);
+    for (std::uint64_t latency = 1; latency <= 1'000; ++latency) {
+        histogram.record(latency * 1'000);
+    }
+    EXPECT_EQ(histogram.count(), 1'000u);
+    EXPECT_EQ(histogram.max(), 1'000'000u);
+    EXPECT_GE(histogram.valueAtPercentile(50), 500'000u);
+    EXPECT_LE(histogram.valueAtPercentile(50), 500'000u + 500'000u / 32);
+    EXPECT_GE(histogram.valueAtPercentile(99), 990'000u);
+    EXPECT_LE(histogram.valueAtPercentile(99), 990'000u + 990'000u / 32);
+    EXPECT_EQ(histogram.valueAtPercentile(100), 1'000'000u);
+    EXPECT_THROW(histogram.valueAtPercentile(101), std::out_of_range);
+    LatencyHistogram mergedHistogram;
+    mergedHistogram.merge(histogram);
+    mergedHistogram.merge(histogram);
+    EXPECT_EQ(mergedHistogram.count(), 2'000u);
+    EXPECT_EQ(mergedHistogram.valueAtPercentile(50), histogram.valueAtPercentile(50));
+
+    // board size classes
+    EXPECT_EQ(LatencyRecorder::boardSizeClass(16, 30), BoardSizeClass::CLASSIC);
+    EXPECT_EQ(LatencyRecorder::boardSizeClass(100, 100), BoardSizeClass::MEDIUM);
+    EXPECT_EQ(LatencyRecorder::boardSizeClass(1'000, 1'000), BoardSizeClass::LARGE);
+    EXPECT_EQ(LatencyRecorder::boardSizeClass(4'000, 4'000), BoardSizeClass::VERY_LARGE);
+
+    // games record latencies of their operations by board size class
+    LatencyRecorder recorder;
+    minesweeper::FastRandom fastRandom(2021);
+    minesweeper::Game classicGame(9, 9, 10, &fastRandom);
+    minesweeper::Game mediumGame(50, 60, 0.05, &fastRandom);
+    EXPECT_FALSE(classicGame.isRecordingLatencies());
+    classicGame.recordLatencies(&recorder);
+    mediumGame.recordLatencies(&recorder);
+    EXPECT_TRUE(classicGame.isRecordingLatencies());
+    classicGame.checkInputCoordinates(4, 4);
+    mediumGame.checkInputCoordinates(30, 25);
+    mediumGame.completeAroundInputCoordinates(30, 25);
+    EXPECT_THROW(mediumGame.checkInputCoordinates(-1, 0), std::out_of_range);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::CHECK, BoardSizeClass::CLASSIC).count(), 1u);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::MINE_GENERATION, BoardSizeClass::CLASSIC).count(), 1u);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::COMPLETE_AROUND, BoardSizeClass::CLASSIC).count(), 0u);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::CHECK, BoardSizeClass::MEDIUM).count(), 1u);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::COMPLETE_AROUND, BoardSizeClass::MEDIUM).count(), 1u);
+    EXPECT_GE(recorder.histogram(LatencyOperation::CHECK, BoardSizeClass::MEDIUM).max(),
+              recorder.histogram(LatencyOperation::MINE_GENERATION, BoardSizeClass::MEDIUM).max());
+
+    // copies do not record, and recording stops with null recorder
+    minesweeper::Game copy(mediumGame);
+    EXPECT_FALSE(copy.isRecordingLatencies());
+    mediumGame.recordLatencies(nullptr);
+    mediumGame.completeAroundInputCoordinates(30, 25);
+    EXPECT_EQ(recorder.histogram(LatencyOperation::COMPLETE_AROUND, BoardSizeClass::MEDIUM).count(), 1u);
+
+    // histograms of threads are merged
+    recorder.reset();
+    EXPECT_EQ(recorder.histogram(LatencyOperation::CHECK, BoardSizeClass::CLASSIC).count(), 0u);
+    const int numOfThreads = 4;
+    const int numOfLatenciesPerThread = 1'000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numOfThreads; ++i) {
+        threads.emplace_back([&recorder, i]() {
+            for (int latency = 1; latency <= numOfLatenciesPerThread; ++latency) {
+                recorder.record(LatencyOperation::CHECK, BoardSizeClass::LARGE,
+                                static_cast<std::uint64_t>(latency * (i + 1)));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const LatencyHistogram merged = recorder.histogram(LatencyOperation::CHECK, BoardSizeClass::LARGE);
+    EXPECT_EQ(merged.count(), static_cast<std::uint64_t>(numOfThreads * numOfLatenciesPerThread));
+    EXPECT_EQ(merged.max(), static_cast<std::uint64_t>(numOfThreads * numOfLatenciesPerThread));
+
+    // JSON dump has every histogram
+    std::ostringstream oss;
+    recorder.serialiseJson(oss);
+    const std::string json = oss.str();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"operation\":\"mineGeneration\""), std::string::npos);
+    EXPECT_NE(json.find("\"boardSizeClass\":\"veryLarge\""), std::string::npos);
+    EXPECT_NE(json.find("\"count\":4000"), std::string::npos);
+}
+
 TEST_F(MinesweeperGameTest, DeserialiseTest) { // TODO: update once deserialise is more advanced
 
     // empty string input
@@ -2558,6 +3653,70 @@ TEST_F(MinesweeperGameTest, DeserialiseTest) { // TODO: update once deserialise
     std::ifstream invalidNumOfMinesJsonGameStream(
         minesweeper::TEST_DATA[minesweeper::invalid____serialisation__DIR__invalidNumOfMines____json]);
     EXPECT_THROW(invalidNumOfMinesJsonGame.deserialise(invalidNumOfMinesJsonGameStream), std::out_of_range);
+
+    // invalid number of mines around a cell
+    minesweeper::Game invalidNumOfMinesAroundJsonGame;
+    std::ifstream invalidNumOfMinesAroundJsonGameStream(
+        minesweeper::TEST_DATA[minesweeper::invalid____serialisation__DIR__invalidNumOfMinesAround____json]);
+    EXPECT_THROW(invalidNumOfMinesAroundJsonGame.deserialise(invalidNumOfMinesAroundJsonGameStream),
+                 std::invalid_argument);
+}
+
+TEST_F(MinesweeperGameTest, DeserialiseKeyOrderAndUnknownKeysTest) {
+
+    // keys in any order, and unknown keys (with any values) are ignored
+    const std::string reorderedGameStr =
+        R"({"version": "1.0", "magic": "Timi's Minesweeper", "unknown": [1, {"cells": 2}, null],)"
+        R"( "currentGame": {"gridWidth": 2, "gridHeight": 1, "numOfMines": 0, "numOfMarkedMines": 0,)"
+        R"( "numOfWronglyMarkedCells": 1, "numOfVisibleCells": 1, "_checkedMine": false, "minesHaveBeenSet": true,)"
+        R"( "cells": [{"rowNumber": 0, "rowCells": [)"
+        R"( {"columnNumber": 1, "cell": {"cellVersion": "1.0", "_numOfMinesAround": 0, "_isVisible": true,)"
+        R"( "_hasMine": false, "_isMarked": false, "unknown": "cell"}},)"
+        R"( {"columnNumber": 0, "unknown": {}, "cell": {"cellVersion": "1.0", "_numOfMinesAround": 0,)"
+        R"( "_isVisible": false, "_hasMine": false, "_isMarked": true}}]}]}} {"next": "game"})";
+    minesweeper::Game reorderedGame;
+    std::istringstream reorderedGameStream(reorderedGameStr);
+    reorderedGame.deserialise(reorderedGameStream);
+    EXPECT_EQ(reorderedGame.getGridHeight(), 1);
+    EXPECT_EQ(reorderedGame.getGridWidth(), 2);
+    EXPECT_TRUE(reorderedGame.isCellMarked(0, 0));
+    EXPECT_TRUE(reorderedGame.isCellVisible(1, 0));
+
+    // stream is left after the serialisation
+    std::string restOfStream;
+    std::getline(reorderedGameStream, restOfStream);
+    EXPECT_EQ(restOfStream, R"( {"next": "game"})");
+
+    // failed deserialisation leaves game unchanged
+    auto expectInvalid = [this](const std::string& invalidGameStr) {
+        minesweeper::Game game;
+        std::istringstream startedGameStream(startedFiveBySixGameStr);
+        game.deserialise(startedGameStream);
+
+        std::istringstream invalidGameStream(invalidGameStr);
+        EXPECT_THROW(game.deserialise(invalidGameStream), std::invalid_argument) << invalidGameStr;
+        EXPECT_EQ(serialiseToString(game), startedFiveBySixGameStr) << invalidGameStr;
+    };
+
+    auto replaced = [this](const std::string& from, const std::string& to) {
+        std::string gameStr = startedFiveBySixGameStr;
+        gameStr.replace(gameStr.find(from), from.size(), to);
+        return gameStr;
+    };
+
+    // cell outside grid
+    expectInvalid(replaced("\"columnNumber\": 5", "\"columnNumber\": 6"));
+    expectInvalid(replaced("\"rowNumber\": 4", "\"rowNumber\": -1"));
+    // values of wrong type
+    expectInvalid(replaced("\"gridHeight\": 5", "\"gridHeight\": true"));
+    expectInvalid(replaced("\"_isVisible\": false", "\"_isVisible\": 0"));
+    expectInvalid(replaced("\"cells\": [", "\"cells\": [1, "));
+    expectInvalid("[]");
+    expectInvalid("null");
+    // missing keys
+    expectInvalid(replaced("\"rowNumber\"", "\"rowNumbr\""));
+    expectInvalid(replaced("\"minesHaveBeenSet\"", "\"minesHaveBeenSt\""));
+    expectInvalid(replaced("\"_isMarked\"", "\"_isMarkd\""));
 }
 
 TEST_F(MinesweeperGameTest, SerialiseAndDeserialiseTest) {
@@ -3048,6 +4207,134 @@ TEST_F(MinesweeperGameTest, VisualiseSolutionDataTest) {
               emptySolutionDataVectorListExpected);
 }
 
+TEST_F(MinesweeperGameTest, VisualiseAreaTest) {
+
+    // premade lost 5x3 game
+    minesweeper::Game premadeFiveByThreeLossGame;
+    ASSERT_NO_THROW(deserialiseFromFile(minesweeper::TEST_DATA[minesweeper::lossGame_fiveByThree_serialisation____json],
+                                        premadeFiveByThreeLossGame));
+
+    // areas outside the grid or with negative dimensions
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualise<std::vector<int>>(-1, 0, 2, 2), std::out_of_range);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualise<std::vector<int>>(0, -1, 2, 2), std::out_of_range);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualise<std::vector<int>>(2, 0, 2, 2), std::out_of_range);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualise<std::vector<std::vector<int>>>(0, 4, 3, 2), std::out_of_range);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualiseSolution<std::vector<int>>(1, 1, -1, 2), std::out_of_range);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualiseSolutionData<std::vector<int>>(1, 1, 1, -2), std::out_of_range);
+
+    // areas inside the grid (whole grid visualisation: {1, 1, 0}, {10, 2, 1}, {2, 3, 10}, {9, -1, 3}, {-1, -1, -1})
+    std::vector<std::vector<int>> middleAreaMatrixExpected{{2, 1}, {3, 10}, {-1, 3}};
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::vector<std::vector<int>>>(1, 1, 2, 3),
+              middleAreaMatrixExpected);
+    std::vector<int> middleAreaVectorExpected{2, 1, 3, 10, -1, 3};
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::vector<int>>(1, 1, 2, 3), middleAreaVectorExpected);
+    std::list<int> bottomLeftCellListExpected{-1};
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::list<int>>(0, 4, 1, 1), bottomLeftCellListExpected);
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::vector<int>>(0, 0, 3, 5),
+              premadeFiveByThreeLossGame.visualise<std::vector<int>>());
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::vector<int>>(3, 5, 0, 0), std::vector<int>());
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::vector<std::vector<int>>>(1, 2, 0, 2),
+              std::vector<std::vector<int>>(2));
+
+    // solution and solution data areas on a grid larger than a visualisation chunk
+    minesweeper::Game largeGame(50, 300, 0.2, &myRandom);
+    largeGame.checkInputCoordinates(150, 25);
+    const std::vector<std::vector<int>> solution = largeGame.visualiseSolution<std::vector<std::vector<int>>>();
+    const std::vector<std::vector<int>> solutionData = largeGame.visualiseSolutionData<std::vector<std::vector<int>>>();
+    std::vector<std::vector<int>> solutionAreaExpected;
+    std::vector<int> solutionDataAreaExpected;
+    for (int y = 10; y < 50; ++y) {
+        solutionAreaExpected.emplace_back(solution[y].begin() + 3, solution[y].begin() + 283);
+        solutionDataAreaExpected.insert(solutionDataAreaExpected.end(), solutionData[y].begin() + 3,
+                                        solutionData[y].begin() + 283);
+    }
+    EXPECT_EQ(largeGame.visualiseSolution<std::vector<std::vector<int>>>(3, 10, 280, 40), solutionAreaExpected);
+    EXPECT_EQ(largeGame.visualiseSolutionData<std::vector<int>>(3, 10, 280, 40), solutionDataAreaExpected);
+}
+
+TEST_F(MinesweeperGameTest, VisualiseIntoBufferTest) {
+
+    // premade lost 5x3 game
+    minesweeper::Game premadeFiveByThreeLossGame;
+    ASSERT_NO_THROW(deserialiseFromFile(minesweeper::TEST_DATA[minesweeper::lossGame_fiveByThree_serialisation____json],
+                                        premadeFiveByThreeLossGame));
+    const std::vector<int> visualExpected{1, 1, 0, 10, 2, 1, 2, 3, 10, 9, -1, 3, -1, -1, -1};
+
+    // buffers of different types
+    std::vector<minesweeper::VisualMinesweeperCell> visualBuffer(15);
+    EXPECT_NO_THROW(premadeFiveByThreeLossGame.visualise(visualBuffer.data(), visualBuffer.size()));
+    EXPECT_EQ(visualBuffer, premadeFiveByThreeLossGame.visualise<std::vector<minesweeper::VisualMinesweeperCell>>());
+    std::vector<std::int8_t> compactBuffer(15);
+    EXPECT_NO_THROW(premadeFiveByThreeLossGame.visualise(compactBuffer.data(), compactBuffer.size()));
+    EXPECT_EQ(std::vector<int>(compactBuffer.begin(), compactBuffer.end()), visualExpected);
+    std::vector<int> intBuffer(15);
+    EXPECT_NO_THROW(premadeFiveByThreeLossGame.visualise(intBuffer.data(), intBuffer.size()));
+    EXPECT_EQ(intBuffer, visualExpected);
+
+    // too small buffer, and larger buffer (only the beginning is written)
+    std::vector<std::int8_t> tooSmallBuffer(14, 42);
+    EXPECT_THROW(premadeFiveByThreeLossGame.visualise(tooSmallBuffer.data(), tooSmallBuffer.size()),
+                 std::invalid_argument);
+    EXPECT_EQ(tooSmallBuffer, std::vector<std::int8_t>(14, 42));
+    std::vector<int> largerBuffer(20, 42);
+    EXPECT_NO_THROW(premadeFiveByThreeLossGame.visualise(largerBuffer.data(), largerBuffer.size()));
+    EXPECT_EQ(std::vector<int>(largerBuffer.begin(), largerBuffer.begin() + 15), visualExpected);
+    EXPECT_EQ(std::vector<int>(largerBuffer.begin() + 15, largerBuffer.end()), std::vector<int>(5, 42));
+
+    // output iterators (returning the end of the output)
+    std::vector<int> insertedVisualisation;
+    premadeFiveByThreeLossGame.visualise<int>(std::back_inserter(insertedVisualisation));
+    EXPECT_EQ(insertedVisualisation, visualExpected);
+    std::vector<std::int8_t> iteratorBuffer(15);
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise<std::int8_t>(iteratorBuffer.begin()), iteratorBuffer.end());
+    EXPECT_EQ(iteratorBuffer, compactBuffer);
+    std::vector<minesweeper::VisualMinesweeperCell> defaultTypeBuffer(15);
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise(defaultTypeBuffer.data()), defaultTypeBuffer.data() + 15);
+    EXPECT_EQ(defaultTypeBuffer, visualBuffer);
+
+    // value type is deduced from the output iterator (or from the container of an insert iterator)
+    std::vector<std::int8_t> deducedCompactBuffer(15);
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise(deducedCompactBuffer.data()), deducedCompactBuffer.data() + 15);
+    EXPECT_EQ(deducedCompactBuffer, compactBuffer);
+    std::vector<int> deducedIntBuffer(15);
+    EXPECT_EQ(premadeFiveByThreeLossGame.visualise(deducedIntBuffer.begin()), deducedIntBuffer.end());
+    EXPECT_EQ(deducedIntBuffer, visualExpected);
+    std::vector<std::int8_t> deducedInsertedVisualisation;
+    premadeFiveByThreeLossGame.visualise(std::back_inserter(deducedInsertedVisualisation));
+    EXPECT_EQ(deducedInsertedVisualisation, compactBuffer);
+
+    // solution and solution data, on a grid large enough to be visualised in many chunks and words
+    minesweeper::Game largeGame(70, 130, 0.2, &myRandom);
+    largeGame.checkInputCoordinates(65, 35);
+    std::vector<std::int8_t> compactSolutionBuffer(70 * 130);
+    largeGame.visualiseSolution(compactSolutionBuffer.data(), compactSolutionBuffer.size());
+    const std::vector<int> solutionExpected = largeGame.visualiseSolution<std::vector<int>>();
+    EXPECT_EQ(std::vector<int>(compactSolutionBuffer.begin(), compactSolutionBuffer.end()), solutionExpected);
+    std::vector<long> longSolutionBuffer(70 * 130);
+    largeGame.visualiseSolution(longSolutionBuffer.data(), longSolutionBuffer.size());
+    EXPECT_EQ(std::vector<int>(longSolutionBuffer.begin(), longSolutionBuffer.end()), solutionExpected);
+    std::vector<minesweeper::VisualMinesweeperCell> solutionDataBuffer(70 * 130);
+    largeGame.visualiseSolutionData(solutionDataBuffer.data(), solutionDataBuffer.size());
+    std::vector<minesweeper::VisualMinesweeperCell> solutionDataExpected;
+    for (int y = 0; y < 70; ++y) {
+        for (int x = 0; x < 130; ++x) {
+            solutionDataExpected.push_back(largeGame.visualiseCellSolutionData(x, y));
+        }
+    }
+    EXPECT_EQ(solutionDataBuffer, solutionDataExpected);
+    std::list<int> solutionDataList;
+    largeGame.visualiseSolutionData<int>(std::back_inserter(solutionDataList));
+    EXPECT_EQ(std::vector<int>(solutionDataList.begin(), solutionDataList.end()),
+              largeGame.visualiseSolutionData<std::vector<int>>());
+    std::vector<std::int8_t> deducedSolutionBuffer(70 * 130);
+    largeGame.visualiseSolution(deducedSolutionBuffer.begin());
+    EXPECT_EQ(deducedSolutionBuffer, compactSolutionBuffer);
+    std::list<int> deducedSolutionDataList;
+    largeGame.visualiseSolutionData(std::back_inserter(deducedSolutionDataList));
+    EXPECT_EQ(deducedSolutionDataList, solutionDataList);
+    EXPECT_THROW(largeGame.visualiseSolutionData(solutionDataBuffer.data(), 70 * 130 - 1), std::invalid_argument);
+}
+
 TEST_F(MinesweeperGameTest, DefaultRandomTest) {
 
     // reset default static random to nullptr
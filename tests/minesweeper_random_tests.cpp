@@ -1,7 +1,9 @@
-#include <vector> // std::vector
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
 
 #include <gtest/gtest.h>
 
+#include <minesweeper/fast_random.h>
 #include <minesweeper/random.h>
 
 TEST(MinesweeperRandomTest, ShuffleVectorTest) {
@@ -26,4 +28,116 @@ TEST(MinesweeperRandomTest, ShuffleVectorTest) {
     auto uniformVecCopy(uniformVec);
     EXPECT_NO_THROW(myRandom.shuffleVector(uniformVec));
     EXPECT_EQ(uniformVec, uniformVecCopy);
-}
\ No newline at end of file
+}
+
+TEST(MinesweeperRandomTest, ChooseIndicesTest) {
+
+    minesweeper::Random myRandom;
+    minesweeper::FastRandom myFastRandom;
+
+    // checks that chosen indices are distinct, within range and not excluded
+    auto expectValidChoice = [](const std::vector<int>& chosenIndices, int numOfChosen, int numOfIndices,
+                                const std::vector<int>& excludedIndices) {
+        EXPECT_EQ(chosenIndices.size(), static_cast<std::size_t>(numOfChosen));
+        std::vector<bool> isChosen(numOfIndices, false);
+        for (int index : chosenIndices) {
+            ASSERT_GE(index, 0);
+            ASSERT_LT(index, numOfIndices);
+            EXPECT_FALSE(isChosen[index]);
+            isChosen[index] = true;
+        }
+        for (int excludedIndex : excludedIndices) {
+            EXPECT_FALSE(isChosen[excludedIndex]);
+        }
+    };
+
+    for (minesweeper::IRandom* random : std::vector<minesweeper::IRandom*>{&myRandom, &myFastRandom}) {
+        std::vector<int> chosenIndices;
+
+        // nothing to choose from
+        EXPECT_NO_THROW(random->chooseIndices(chosenIndices, 0, 0, {}));
+        EXPECT_TRUE(chosenIndices.empty());
+
+        // sparse choice without exclusions
+        random->chooseIndices(chosenIndices, 10, 1'000, {});
+        expectValidChoice(chosenIndices, 10, 1'000, {});
+
+        // sparse choice with exclusions
+        std::vector<int> excludedIndices{0, 1, 2, 40, 41, 42, 80, 81, 82};
+        random->chooseIndices(chosenIndices, 100, 1'600, excludedIndices);
+        expectValidChoice(chosenIndices, 100, 1'600, excludedIndices);
+
+        // dense choice with exclusions
+        random->chooseIndices(chosenIndices, 1'500, 1'600, excludedIndices);
+        expectValidChoice(chosenIndices, 1'500, 1'600, excludedIndices);
+
+        // everything except exclusions
+        random->chooseIndices(chosenIndices, 1'591, 1'600, excludedIndices);
+        expectValidChoice(chosenIndices, 1'591, 1'600, excludedIndices);
+    }
+}
+
+TEST(MinesweeperRandomTest, SeededRandomTest) {
+
+    std::vector<int> excludedIndices{0, 1, 2, 40, 41, 42, 80, 81, 82};
+
+    // same seed, same choice
+    minesweeper::Random firstRandom(2021);
+    minesweeper::Random secondRandom(2021);
+    std::vector<int> firstChosen;
+    std::vector<int> secondChosen;
+    firstRandom.chooseIndices(firstChosen, 100, 1'600, excludedIndices);
+    secondRandom.chooseIndices(secondChosen, 100, 1'600, excludedIndices);
+    EXPECT_EQ(firstChosen, secondChosen);
+
+    minesweeper::FastRandom firstFastRandom(2021);
+    minesweeper::FastRandom secondFastRandom(2021);
+    firstFastRandom.chooseIndices(firstChosen, 100, 1'600, excludedIndices);
+    secondFastRandom.chooseIndices(secondChosen, 100, 1'600, excludedIndices);
+    EXPECT_EQ(firstChosen, secondChosen);
+
+    // reseeding restarts the sequence
+    firstFastRandom.seed(7);
+    secondFastRandom.seed(7);
+    EXPECT_EQ(firstFastRandom(), secondFastRandom());
+}
+
+TEST(MinesweeperRandomTest, FastRandomReferenceTest) {
+
+    // FastRandom has to produce identical results on every platform
+    // (reference values from an independent implementation of xoshiro256** seeded by splitmix64)
+    minesweeper::FastRandom fastRandom(2021);
+    EXPECT_EQ(fastRandom(), 0xf61612c2ff4d9bc1ULL);
+    EXPECT_EQ(fastRandom(), 0x584f61ab0b9a78b4ULL);
+    EXPECT_EQ(fastRandom(), 0x8153a8240f70a3e2ULL);
+
+    fastRandom.seed(2021);
+    std::vector<int> uniformInts;
+    for (int i = 0; i < 8; ++i) {
+        uniformInts.push_back(static_cast<int>(fastRandom.uniformInt(99)));
+    }
+    EXPECT_EQ(uniformInts, std::vector<int>({96, 34, 50, 96, 74, 80, 44, 47}));
+
+    fastRandom.seed(2021);
+    std::vector<int> vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    fastRandom.shuffleVector(vec);
+    EXPECT_EQ(vec, std::vector<int>({0, 2, 8, 1, 5, 7, 6, 4, 3, 9}));
+}
+
+TEST(MinesweeperRandomTest, DefaultChooseIndicesTest) {
+
+    // random which does not shuffle at all, so that default 'chooseIndices' is predictable
+    class NoShuffleRandom : public minesweeper::IRandom {
+      public:
+        void shuffleVector(std::vector<int>& /*vec*/) override {}
+    };
+
+    NoShuffleRandom noShuffleRandom;
+    std::vector<int> chosenIndices;
+
+    noShuffleRandom.chooseIndices(chosenIndices, 4, 10, {1, 3, 4});
+    EXPECT_EQ(chosenIndices, std::vector<int>({0, 2, 5, 6}));
+
+    noShuffleRandom.chooseIndices(chosenIndices, 7, 10, {1, 3, 4});
+    EXPECT_EQ(chosenIndices, std::vector<int>({0, 2, 5, 6, 7, 8, 9}));
+}
@@ -958,3 +958,24 @@ TEST_F(MinesweeperTypeTraitsTest, is_expandable_2d_sequence_containerTest) {
     EXPECT_FALSE(minesweeper::is_expandable_2d_sequence_container< //
                  CustomExpandSeqContainer<CustomExpandSeqContainer<CustomExpandSeqContainer<CustomEnumClass>>>>::value);
 }
+
+TEST_F(MinesweeperTypeTraitsTest, has_reserveTest) {
+
+    // simple data types
+    // invalid
+    EXPECT_FALSE(minesweeper::has_reserve<int>::value);
+    EXPECT_FALSE(minesweeper::has_reserve<int*>::value);
+    EXPECT_FALSE(minesweeper::has_reserve<EmptyCustomClass>::value);
+    EXPECT_FALSE(minesweeper::has_reserve<CustomEnumClass>::value);
+
+    // containers with 'reserve'
+    // valid
+    EXPECT_TRUE(minesweeper::has_reserve<std::vector<int>>::value);
+    EXPECT_TRUE(minesweeper::has_reserve<std::vector<std::vector<int>>>::value);
+    EXPECT_TRUE(minesweeper::has_reserve<std::string>::value);
+
+    // containers without 'reserve'
+    // invalid
+    EXPECT_FALSE(minesweeper::has_reserve<std::list<int>>::value);
+    EXPECT_FALSE(minesweeper::has_reserve<CustomExpandSeqContainer<int>>::value);
+}